@@ -0,0 +1,534 @@
+//
+//  AmericanApproximation.cpp
+//  GroupA&B
+//
+
+#include "AmericanApproximation.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+using namespace std;
+
+
+// Relative tolerance on the BAW critical price equation and the iteration limit
+const double BAW_TOLERANCE = 1.0e-10;
+const int BAW_MAX_ITERATIONS = 100;
+
+
+// standard normal cdf and pdf without constructing a boost distribution
+static inline double ncdf(double x)
+{
+    return 0.5 * erfc(-x * M_SQRT1_2);
+}
+
+static inline double npdf(double x)
+{
+    return exp(-0.5 * x * x) / sqrt(2.0 * M_PI);
+}
+
+
+// Bivariate standard normal cdf P(X < x, Y < y) with correlation rho,
+// Genz (2004) with 6, 12 or 20 point Gauss-Legendre rules; about 1e-15 accurate
+static double bivariateNcdf(double x, double y, double rho)
+{
+    static const double X[3][10] = {
+        { -0.9324695142031522, -0.6612093864662647, -0.2386191860831970 },
+        { -0.9815606342467191, -0.9041172563704750, -0.7699026741943050,
+          -0.5873179542866171, -0.3678314989981802, -0.1252334085114692 },
+        { -0.9931285991850949, -0.9639719272779138, -0.9122344282513259,
+          -0.8391169718222188, -0.7463319064601508, -0.6360536807265150,
+          -0.5108670019508271, -0.3737060887154196, -0.2277858511416451,
+          -0.07652652113349733 } };
+
+    static const double W[3][10] = {
+        { 0.1713244923791705, 0.3607615730481384, 0.4679139345726904 },
+        { 0.04717533638651177, 0.1069393259953183, 0.1600783285433464,
+          0.2031674267230659, 0.2334925365383547, 0.2491470458134029 },
+        { 0.01761400713915212, 0.04060142980038694, 0.06267204833410906,
+          0.08327674157670475, 0.1019301198172404, 0.1181945319615184,
+          0.1316886384491766, 0.1420961093183821, 0.1491729864726037,
+          0.1527533871307259 } };
+
+    int ng, lg;
+    if (fabs(rho) < 0.3)
+    {
+        ng = 0; lg = 3;
+    }
+    else if (fabs(rho) < 0.75)
+    {
+        ng = 1; lg = 6;
+    }
+    else
+    {
+        ng = 2; lg = 10;
+    }
+
+    double h = -x;
+    double k = -y;
+    double hk = h * k;
+    double bvn = 0.0;
+
+    if (fabs(rho) < 0.925)
+    {
+        if (fabs(rho) > 0.0)
+        {
+            double hs = (h * h + k * k) / 2.0;
+            double asr = asin(rho);
+
+            for (int i = 0; i < lg; i++)
+            {
+                for (int is = -1; is <= 1; is += 2)
+                {
+                    double sn = sin(asr * (is * X[ng][i] + 1.0) / 2.0);
+                    bvn += W[ng][i] * exp((sn * hk - hs) / (1.0 - sn * sn));
+                }
+            }
+            bvn *= asr / (4.0 * M_PI);
+        }
+
+        return bvn + ncdf(-h) * ncdf(-k);
+    }
+
+    if (rho < 0.0)
+    {
+        k = -k;
+        hk = -hk;
+    }
+
+    if (fabs(rho) < 1.0)
+    {
+        double as = (1.0 - rho) * (1.0 + rho);
+        double a = sqrt(as);
+        double bs = (h - k) * (h - k);
+        double c = (4.0 - hk) / 8.0;
+        double d = (12.0 - hk) / 16.0;
+        double asr = -(bs / as + hk) / 2.0;
+
+        if (asr > -100.0)
+        {
+            bvn = a * exp(asr) * (1.0 - c * (bs - as) * (1.0 - d * bs / 5.0) / 3.0 + c * d * as * as / 5.0);
+        }
+
+        if (-hk < 100.0)
+        {
+            double b = sqrt(bs);
+            bvn -= exp(-hk / 2.0) * sqrt(2.0 * M_PI) * ncdf(-b / a) * b * (1.0 - c * bs * (1.0 - d * bs / 5.0) / 3.0);
+        }
+
+        a /= 2.0;
+
+        for (int i = 0; i < lg; i++)
+        {
+            for (int is = -1; is <= 1; is += 2)
+            {
+                double xs = a * (is * X[ng][i] + 1.0);
+                xs *= xs;
+                double rs = sqrt(1.0 - xs);
+                asr = -(bs / xs + hk) / 2.0;
+
+                if (asr > -100.0)
+                {
+                    bvn += a * W[ng][i] * exp(asr) * (exp(-hk * (1.0 - rs) / (2.0 * (1.0 + rs))) / rs - (1.0 + c * xs * (1.0 + d * xs)));
+                }
+            }
+        }
+
+        bvn = -bvn / (2.0 * M_PI);
+    }
+
+    if (rho > 0.0)
+    {
+        return bvn + ncdf(-max(h, k));
+    }
+
+    bvn = -bvn;
+    if (k > h)
+    {
+        bvn += ncdf(k) - ncdf(h);
+    }
+
+    return bvn;
+}
+
+
+// Generalised Black-Scholes price
+static inline double europeanPrice(double S, double K, double T, double r, double b, double sig, bool call)
+{
+    double sqrtT = sqrt(T);
+    double d1 = (log(S / K) + (b + 0.5 * sig * sig) * T) / (sig * sqrtT);
+    double d2 = d1 - sig * sqrtT;
+
+    if (call)
+    {
+        return S * exp((b - r) * T) * ncdf(d1) - K * exp(-r * T) * ncdf(d2);
+    }
+
+    return K * exp(-r * T) * ncdf(-d2) - S * exp((b - r) * T) * ncdf(-d1);
+}
+
+
+//////////////////// Barone-Adesi and Whaley ////////////////////
+
+// Everything except S: critical price Sc and the premium A (S / Sc)^q
+struct BAWBoundary
+{
+    bool european;  // no early exercise premium
+    bool call;
+    double Sc;
+    double A;
+    double q;
+    int iterations;
+};
+
+
+static BAWBoundary bawBoundary(const OptionData& d)
+{
+    BAWBoundary bd;
+
+    bd.call = (d.oType == 0);
+    bd.iterations = 0;
+    bd.Sc = bd.A = bd.q = 0.0;
+
+    // a call is never exercised early when b >= r, a put when r <= 0
+    bd.european = bd.call ? (d.b >= d.r) : (d.r <= 0.0);
+    if (bd.european)
+    {
+        return bd;
+    }
+
+    double K = d.K, T = d.T, r = d.r, b = d.b, sig = d.sig;
+    double sig2 = sig * sig;
+    double sqrtT = sqrt(T);
+    double carry = exp((b - r) * T);
+
+    double n = 2.0 * b / sig2;
+    double m = 2.0 * r / sig2;
+    // K = 1 - exp(-rT); m / K tends to 2 / (sig^2 T) as rT -> 0
+    double Kk = (fabs(r * T) < 1.0e-12) ? 2.0 / (sig2 * T) : m / -expm1(-r * T);
+
+    // seed value for the critical price from the perpetual boundary
+    double Si;
+    if (bd.call)
+    {
+        double qu = (-(n - 1.0) + sqrt((n - 1.0) * (n - 1.0) + 4.0 * m)) / 2.0;
+        double Su = K / (1.0 - 1.0 / qu);
+        double h2 = -(b * T + 2.0 * sig * sqrtT) * K / (Su - K);
+
+        bd.q = (-(n - 1.0) + sqrt((n - 1.0) * (n - 1.0) + 4.0 * Kk)) / 2.0;
+        Si = K + (Su - K) * (1.0 - exp(h2));
+    }
+    else
+    {
+        double qu = (-(n - 1.0) - sqrt((n - 1.0) * (n - 1.0) + 4.0 * m)) / 2.0;
+        double Su = K / (1.0 - 1.0 / qu);
+        double h1 = (b * T - 2.0 * sig * sqrtT) * K / (K - Su);
+
+        bd.q = (-(n - 1.0) - sqrt((n - 1.0) * (n - 1.0) + 4.0 * Kk)) / 2.0;
+        Si = Su + (K - Su) * exp(h1);
+    }
+
+    // Newton iteration on the value matching condition at Si
+    double q = bd.q;
+    for (;;)
+    {
+        double d1 = (log(Si / K) + (b + 0.5 * sig2) * T) / (sig * sqrtT);
+
+        double LHS, RHS, slope;
+        if (bd.call)
+        {
+            LHS = Si - K;
+            RHS = europeanPrice(Si, K, T, r, b, sig, true) + (1.0 - carry * ncdf(d1)) * Si / q;
+            slope = carry * ncdf(d1) * (1.0 - 1.0 / q) + (1.0 - carry * npdf(d1) / (sig * sqrtT)) / q;
+        }
+        else
+        {
+            LHS = K - Si;
+            RHS = europeanPrice(Si, K, T, r, b, sig, false) - (1.0 - carry * ncdf(-d1)) * Si / q;
+            slope = -carry * ncdf(-d1) * (1.0 - 1.0 / q) - (1.0 + carry * npdf(-d1) / (sig * sqrtT)) / q;
+        }
+
+        if (fabs(LHS - RHS) / K <= BAW_TOLERANCE)
+        {
+            bd.Sc = Si;
+            bd.A = bd.call ? (Si / q) * (1.0 - carry * ncdf(d1)) : -(Si / q) * (1.0 - carry * ncdf(-d1));
+            return bd;
+        }
+
+        if (bd.iterations == BAW_MAX_ITERATIONS)
+        {
+            throw runtime_error("BaroneAdesiWhaley: no critical price after " + to_string(BAW_MAX_ITERATIONS) + " Newton steps");
+        }
+
+        Si = bd.call ? (K + RHS - slope * Si) / (1.0 - slope) : (K - RHS + slope * Si) / (1.0 + slope);
+        bd.iterations++;
+    }
+}
+
+
+static inline double bawPrice(const BAWBoundary& bd, const OptionData& d)
+{
+    double S = d.S;
+    double european = europeanPrice(S, d.K, d.T, d.r, d.b, d.sig, bd.call);
+
+    if (bd.european)
+    {
+        return european;
+    }
+
+    if (bd.call)
+    {
+        return (S >= bd.Sc) ? S - d.K : european + bd.A * pow(S / bd.Sc, bd.q);
+    }
+
+    return (S <= bd.Sc) ? d.K - S : european + bd.A * pow(S / bd.Sc, bd.q);
+}
+
+
+double BaroneAdesiWhaley(const OptionData& optData, int* iterations)
+{
+    BAWBoundary bd = bawBoundary(optData);
+
+    if (iterations)
+    {
+        *iterations = bd.iterations;
+    }
+
+    return bawPrice(bd, optData);
+}
+
+
+double BaroneAdesiWhaleyCriticalPrice(const OptionData& optData, int* iterations)
+{
+    BAWBoundary bd = bawBoundary(optData);
+
+    if (iterations)
+    {
+        *iterations = bd.iterations;
+    }
+
+    // no early exercise: the boundary is at infinity (call) or zero (put)
+    if (bd.european)
+    {
+        return bd.call ? INFINITY : 0.0;
+    }
+
+    return bd.Sc;
+}
+
+
+//////////////////// Bjerksund and Stensland (2002) ////////////////////
+
+// Call with spot S and strike K; puts are mapped onto this by the transformation
+struct BSCall
+{
+    double S, K, T, r, b, sig;
+};
+
+
+// Everything except the spot of the (transformed) call
+struct BSBoundary
+{
+    bool european;
+    double beta;
+    double t1;
+    double I1, I2;
+    double alpha1, alpha2;
+};
+
+
+static inline BSCall transform(const OptionData& d)
+{
+    if (d.oType == 0)
+    {
+        return BSCall{ d.S, d.K, d.T, d.r, d.b, d.sig };
+    }
+
+    // P(S, K, T, r, b, sig) = C(K, S, T, r - b, -b, sig)
+    return BSCall{ d.K, d.S, d.T, d.r - d.b, -d.b, d.sig };
+}
+
+
+static BSBoundary bsBoundary(const BSCall& c)
+{
+    BSBoundary bd;
+
+    bd.european = (c.b >= c.r);
+    if (bd.european)
+    {
+        return bd;
+    }
+
+    double sig2 = c.sig * c.sig;
+
+    bd.beta = (0.5 - c.b / sig2) + sqrt((c.b / sig2 - 0.5) * (c.b / sig2 - 0.5) + 2.0 * c.r / sig2);
+    bd.t1 = 0.5 * (sqrt(5.0) - 1.0) * c.T;
+
+    double BInfinity = bd.beta / (bd.beta - 1.0) * c.K;
+    double B0 = max(c.K, c.r / (c.r - c.b) * c.K);
+
+    double h1 = -(c.b * bd.t1 + 2.0 * c.sig * sqrt(bd.t1)) * c.K * c.K / ((BInfinity - B0) * B0);
+    double h2 = -(c.b * c.T + 2.0 * c.sig * sqrt(c.T)) * c.K * c.K / ((BInfinity - B0) * B0);
+
+    bd.I1 = B0 + (BInfinity - B0) * (1.0 - exp(h1));
+    bd.I2 = B0 + (BInfinity - B0) * (1.0 - exp(h2));
+
+    bd.alpha1 = (bd.I1 - c.K) * pow(bd.I1, -bd.beta);
+    bd.alpha2 = (bd.I2 - c.K) * pow(bd.I2, -bd.beta);
+
+    return bd;
+}
+
+
+// phi(S, T, gamma, H, I) of the paper
+static double phi(const BSCall& c, double T, double gamma, double H, double I)
+{
+    double sig2 = c.sig * c.sig;
+    double sqrtT = sqrt(T);
+
+    double lambda = (-c.r + gamma * c.b + 0.5 * gamma * (gamma - 1.0) * sig2) * T;
+    double d = -(log(c.S / H) + (c.b + (gamma - 0.5) * sig2) * T) / (c.sig * sqrtT);
+    double kappa = 2.0 * c.b / sig2 + (2.0 * gamma - 1.0);
+
+    return exp(lambda) * pow(c.S, gamma) * (ncdf(d) - pow(I / c.S, kappa) * ncdf(d - 2.0 * log(I / c.S) / (c.sig * sqrtT)));
+}
+
+
+// psi(S, T, gamma, H, I2, I1, t1) of the paper
+static double psi(const BSCall& c, double T, double gamma, double H, double I2, double I1, double t1)
+{
+    double sig2 = c.sig * c.sig;
+    double drift = c.b + (gamma - 0.5) * sig2;
+    double s1 = c.sig * sqrt(t1);
+    double sT = c.sig * sqrt(T);
+
+    double e1 = (log(c.S / I1) + drift * t1) / s1;
+    double e2 = (log(I2 * I2 / (c.S * I1)) + drift * t1) / s1;
+    double e3 = (log(c.S / I1) - drift * t1) / s1;
+    double e4 = (log(I2 * I2 / (c.S * I1)) - drift * t1) / s1;
+
+    double f1 = (log(c.S / H) + drift * T) / sT;
+    double f2 = (log(I2 * I2 / (c.S * H)) + drift * T) / sT;
+    double f3 = (log(I1 * I1 / (c.S * H)) + drift * T) / sT;
+    double f4 = (log(c.S * I1 * I1 / (H * I2 * I2)) + drift * T) / sT;
+
+    double rho = sqrt(t1 / T);
+    double lambda = -c.r + gamma * c.b + 0.5 * gamma * (gamma - 1.0) * sig2;
+    double kappa = 2.0 * c.b / sig2 + (2.0 * gamma - 1.0);
+
+    return exp(lambda * T) * pow(c.S, gamma) * (bivariateNcdf(-e1, -f1, rho)
+                                                - pow(I2 / c.S, kappa) * bivariateNcdf(-e2, -f2, rho)
+                                                - pow(I1 / c.S, kappa) * bivariateNcdf(-e3, -f3, -rho)
+                                                + pow(I1 / I2, kappa) * bivariateNcdf(-e4, -f4, -rho));
+}
+
+
+static double bsPrice(const BSBoundary& bd, const BSCall& c)
+{
+    if (bd.european)
+    {
+        return europeanPrice(c.S, c.K, c.T, c.r, c.b, c.sig, true);
+    }
+
+    if (c.S >= bd.I2)
+    {
+        return c.S - c.K;
+    }
+
+    double K = c.K, t1 = bd.t1, T = c.T, beta = bd.beta;
+    double I1 = bd.I1, I2 = bd.I2, a1 = bd.alpha1, a2 = bd.alpha2;
+
+    return a2 * pow(c.S, beta) - a2 * phi(c, t1, beta, I2, I2)
+            + phi(c, t1, 1.0, I2, I2) - phi(c, t1, 1.0, I1, I2)
+            - K * phi(c, t1, 0.0, I2, I2) + K * phi(c, t1, 0.0, I1, I2)
+            + a1 * phi(c, t1, beta, I1, I2) - a1 * psi(c, T, beta, I1, I2, I1, t1)
+            + psi(c, T, 1.0, I1, I2, I1, t1) - psi(c, T, 1.0, K, I2, I1, t1)
+            - K * psi(c, T, 0.0, I1, I2, I1, t1) + K * psi(c, T, 0.0, K, I2, I1, t1);
+}
+
+
+double BjerksundStensland(const OptionData& optData)
+{
+    BSCall c = transform(optData);
+    return bsPrice(bsBoundary(c), c);
+}
+
+
+//////////////////// Batches ////////////////////
+
+// same option apart from the spot (BAW) or the spot of the transformed call (BS)
+static inline bool sameBoundary(const OptionData& x, const OptionData& y)
+{
+    return x.K == y.K && x.T == y.T && x.r == y.r && x.b == y.b && x.sig == y.sig && x.oType == y.oType;
+}
+
+static inline bool sameBoundary(const BSCall& x, const BSCall& y)
+{
+    return x.K == y.K && x.T == y.T && x.r == y.r && x.b == y.b && x.sig == y.sig;
+}
+
+
+void BaroneAdesiWhaley(const vector<OptionData>& book, double* price)
+{
+    BAWBoundary bd{};
+
+    for (size_t i = 0; i < book.size(); i++)
+    {
+        // the boundary is only recomputed when something other than S changes
+        if (i == 0 || !sameBoundary(book[i], book[i - 1]))
+        {
+            bd = bawBoundary(book[i]);
+        }
+
+        price[i] = bawPrice(bd, book[i]);
+    }
+}
+
+
+void BjerksundStensland(const vector<OptionData>& book, double* price)
+{
+    BSBoundary bd{};
+    BSCall previous{};
+
+    for (size_t i = 0; i < book.size(); i++)
+    {
+        BSCall c = transform(book[i]);
+
+        if (i == 0 || !sameBoundary(c, previous))
+        {
+            bd = bsBoundary(c);
+        }
+
+        price[i] = bsPrice(bd, c);
+        previous = c;
+    }
+}
+
+
+vector<double> BaroneAdesiWhaley(const vector<OptionData>& book)
+{
+    vector<double> price(book.size());
+
+    if (!book.empty())
+    {
+        BaroneAdesiWhaley(book, &price[0]);
+    }
+
+    return price;
+}
+
+
+vector<double> BjerksundStensland(const vector<OptionData>& book)
+{
+    vector<double> price(book.size());
+
+    if (!book.empty())
+    {
+        BjerksundStensland(book, &price[0]);
+    }
+
+    return price;
+}
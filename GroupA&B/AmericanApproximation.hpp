@@ -0,0 +1,54 @@
+//
+//  AmericanApproximation.hpp
+//  GroupA&B
+//
+
+// Analytic approximations for American options with a finite expiry T under
+// the generalised Black-Scholes model (cost of carry b). AmericanOption only
+// prices perpetual options (T -> infinity); these functions price in well
+// under a microsecond, so a lattice is only needed for the final marks.
+//
+//  Barone-Adesi and Whaley (1987): quadratic approximation of the early
+//  exercise premium; the critical stock price is found by Newton iteration.
+//
+//  Bjerksund and Stensland (2002): value of a two-step flat exercise boundary;
+//  a lower bound that is usually closer to the true price than BAW for long
+//  expiries. Puts use the put-call transformation P(S, K, r, b) = C(K, S, r - b, -b).
+//
+// When b >= r a call is never exercised early and both return the European price.
+//
+// The batch functions take a book of options. The exercise boundary does not
+// depend on S, so it is computed once for consecutive options that differ only
+// in S (e.g. a sweep over the underlying).
+
+#ifndef AmericanApproximation_hpp
+#define AmericanApproximation_hpp
+
+#include <vector>
+
+#include "Option.hpp"
+
+using namespace std;
+
+
+// Barone-Adesi and Whaley; if iterations is given it receives the number of Newton steps.
+// Throws runtime_error if the Newton iteration for the critical price does not converge
+double BaroneAdesiWhaley(const OptionData& optData, int* iterations = nullptr);
+
+// Critical stock price of BAW: exercise at or above it (call), at or below it (put)
+double BaroneAdesiWhaleyCriticalPrice(const OptionData& optData, int* iterations = nullptr);
+
+// Bjerksund and Stensland (2002)
+double BjerksundStensland(const OptionData& optData);
+
+
+// Prices of a whole book
+vector<double> BaroneAdesiWhaley(const vector<OptionData>& book);
+vector<double> BjerksundStensland(const vector<OptionData>& book);
+
+// As above, writing into an existing array of book.size() elements
+void BaroneAdesiWhaley(const vector<OptionData>& book, double* price);
+void BjerksundStensland(const vector<OptionData>& book, double* price);
+
+
+#endif /* AmericanApproximation_hpp */
@@ -0,0 +1,213 @@
+//
+//  CompiledOption.cpp
+//  GroupA&B
+//
+
+#include "CompiledOption.hpp"
+
+#include <cmath>
+
+using namespace std;
+
+
+// N(x) given e = exp(-x^2 / 2); Hart (1968) as given by West (2005)
+static inline double cumulativeNormal(double x, double e)
+{
+    double xAbs = fabs(x);
+    double c;
+
+    if (xAbs > 37.0)
+    {
+        c = 0.0;
+    }
+    else if (xAbs < 7.07106781186547)
+    {
+        double p = 3.52624965998911e-02 * xAbs + 0.700383064443688;
+        p = p * xAbs + 6.37396220353165;
+        p = p * xAbs + 33.912866078383;
+        p = p * xAbs + 112.079291497871;
+        p = p * xAbs + 221.213596169931;
+        p = p * xAbs + 220.206867912376;
+
+        double q = 8.83883476483184e-02 * xAbs + 1.75566716318264;
+        q = q * xAbs + 16.064177579207;
+        q = q * xAbs + 86.7807322029461;
+        q = q * xAbs + 296.564248779674;
+        q = q * xAbs + 637.333633378831;
+        q = q * xAbs + 793.826512519948;
+        q = q * xAbs + 440.413735824752;
+
+        c = e * p / q;
+    }
+    else
+    {
+        // continued fraction
+        double f = xAbs + 0.65;
+        f = xAbs + 4.0 / f;
+        f = xAbs + 3.0 / f;
+        f = xAbs + 2.0 / f;
+        f = xAbs + 1.0 / f;
+
+        c = e / f / 2.506628274631;
+    }
+
+    return (x > 0.0) ? 1.0 - c : c;
+}
+
+
+// d1, d2 and exp(-d^2 / 2) of both
+struct NormalTerms
+{
+    double d1, d2;
+    double e1, e2;
+};
+
+
+static inline NormalTerms normalTerms(double S, double logS, double drift, double invSigSqrtT,
+                                      double sigSqrtT, double carryDiscount, double KD)
+{
+    NormalTerms t;
+
+    t.d1 = (logS + drift) * invSigSqrtT;
+    t.d2 = t.d1 - sigSqrtT;
+    t.e1 = exp(-0.5 * t.d1 * t.d1);
+
+    // exp(-d2^2 / 2) = exp(-d1^2 / 2) S e^((b-r)T) / K e^(-rT), unless the first underflowed
+    t.e2 = (t.e1 > 1.0e-250) ? t.e1 * (S * carryDiscount / KD) : exp(-0.5 * t.d2 * t.d2);
+
+    return t;
+}
+
+
+CompiledOption::CompiledOption(const OptionData& source) : optData(source)
+{
+    double T = source.T;
+    double sig = source.sig;
+
+    sqrtT = sqrt(T);
+    sigSqrtT = sig * sqrtT;
+    invSigSqrtT = 1.0 / sigSqrtT;
+    drift = (source.b + 0.5 * sig * sig) * T - log(source.K);
+
+    carryDiscount = exp((source.b - source.r) * T);
+    discount = exp(-source.r * T);
+    KD = source.K * discount;
+
+    phi = (source.oType == 0) ? 1.0 : -1.0;
+}
+
+
+double CompiledOption::Price(double S, double logS) const
+{
+    NormalTerms t = normalTerms(S, logS, drift, invSigSqrtT, sigSqrtT, carryDiscount, KD);
+
+    // phi (S e^((b-r)T) N(phi d1) - K e^(-rT) N(phi d2))
+    return phi * (S * carryDiscount * cumulativeNormal(phi * t.d1, t.e1) - KD * cumulativeNormal(phi * t.d2, t.e2));
+}
+
+
+double CompiledOption::Price(double S) const
+{
+    return Price(S, log(S));
+}
+
+
+OptionGreeks CompiledOption::Greeks(double S) const
+{
+    NormalTerms t = normalTerms(S, log(S), drift, invSigSqrtT, sigSqrtT, carryDiscount, KD);
+
+    double r = optData.r;
+    double b = optData.b;
+    double T = optData.T;
+
+    // N(phi d) for this option type, n(d1)
+    double Nd1 = cumulativeNormal(phi * t.d1, t.e1);
+    double Nd2 = cumulativeNormal(phi * t.d2, t.e2);
+    double nd1 = t.e1 / sqrt(2.0 * M_PI);
+
+    double SD = S * carryDiscount;
+
+    OptionGreeks g;
+
+    g.price = phi * (SD * Nd1 - KD * Nd2);
+    g.delta = phi * carryDiscount * Nd1;
+    g.gamma = nd1 * carryDiscount / (S * sigSqrtT);
+    g.vega = SD * nd1 * sqrtT;
+    g.theta = -SD * nd1 * optData.sig / (2 * sqrtT) - phi * ((b - r) * SD * Nd1 + r * KD * Nd2);
+    g.rho = phi * T * KD * Nd2;
+    g.carry = phi * T * SD * Nd1;
+
+    return g;
+}
+
+
+size_t CompiledBook::AddUnderlying(double S)
+{
+    underlyings.push_back(Underlying());
+    underlyings.back().S = S;
+
+    return underlyings.size() - 1;
+}
+
+
+size_t CompiledBook::Add(const OptionData& optData, size_t underlying)
+{
+    Underlying& u = underlyings.at(underlying);
+
+    u.options.push_back(CompiledOption(optData));
+    u.prices.push_back(u.options.back().Price(u.S));
+
+    location.push_back(make_pair(underlying, u.options.size() - 1));
+
+    return location.size() - 1;
+}
+
+
+void CompiledBook::Update(size_t underlying, double S)
+{
+    Underlying& u = underlyings.at(underlying);
+
+    u.S = S;
+    double logS = log(S);
+
+    for (size_t i = 0; i < u.options.size(); i++)
+    {
+        u.prices[i] = u.options[i].Price(S, logS);
+    }
+}
+
+
+double CompiledBook::Spot(size_t underlying) const
+{
+    return underlyings.at(underlying).S;
+}
+
+
+double CompiledBook::Price(size_t contract) const
+{
+    const pair<size_t, size_t>& at = location.at(contract);
+
+    return underlyings[at.first].prices[at.second];
+}
+
+
+OptionGreeks CompiledBook::Greeks(size_t contract) const
+{
+    const pair<size_t, size_t>& at = location.at(contract);
+    const Underlying& u = underlyings[at.first];
+
+    return u.options[at.second].Greeks(u.S);
+}
+
+
+vector<double> CompiledBook::Prices() const
+{
+    vector<double> price(location.size());
+
+    for (size_t i = 0; i < location.size(); i++)
+    {
+        price[i] = underlyings[location[i].first].prices[location[i].second];
+    }
+
+    return price;
+}
@@ -0,0 +1,109 @@
+//
+//  CompiledOption.hpp
+//  GroupA&B
+//
+
+// European options "compiled" for fast repricing when only the underlying moves.
+// log(K), sig * sqrt(T), the drift of d1 and the discount factors do not depend
+// on S, so they are computed once when the option is built; a reprice is then
+// a few multiplications, one exp and two rational functions for N(d1), N(d2).
+// The exp is shared: S e^((b-r)T) n(d1) = K e^(-rT) n(d2), so exp(-d2^2 / 2)
+// follows from exp(-d1^2 / 2) and the moneyness. N is Hart's double precision
+// approximation (West, 2005), about 1e-14 relative.
+//
+// Prices use the generalised Black-Scholes formula, as EuropeanOption::Price().
+//
+// CompiledBook holds a book grouped by underlying. Update(underlying, S)
+// reprices only the contracts on that underlying and computes log(S) once
+// for all of them.
+
+#ifndef CompiledOption_hpp
+#define CompiledOption_hpp
+
+#include <cstddef>
+#include <utility>
+#include <vector>
+
+#include "Option.hpp"
+#include "EuropeanOption.hpp"
+
+using namespace std;
+
+
+class CompiledOption
+{
+private:
+    OptionData optData;     // as given; S is only the spot at construction
+
+    double drift;           // (b + sig^2 / 2) T - log(K), so d1 = (log(S) + drift) / sig sqrt(T)
+    double sqrtT;
+    double sigSqrtT;
+    double invSigSqrtT;
+    double carryDiscount;   // e^((b-r)T)
+    double discount;        // e^(-rT)
+    double KD;              // K e^(-rT)
+    double phi;             // 1 for calls, -1 for puts
+
+public:
+
+    CompiledOption(const OptionData& source);
+
+    OptionData getOptionData() const
+    {
+        return optData;
+    }
+
+    // price at spot S
+    double Price(double S) const;
+
+    // as above with log(S) given, so that it is computed once per underlying
+    double Price(double S, double logS) const;
+
+    // price and all greeks at spot S; the same values as EuropeanOption::Greeks()
+    OptionGreeks Greeks(double S) const;
+};
+
+
+class CompiledBook
+{
+private:
+
+    // the contracts on one underlying and their prices at its current spot
+    struct Underlying
+    {
+        double S;
+        vector<CompiledOption> options;
+        vector<double> prices;
+    };
+
+    vector<Underlying> underlyings;
+    vector<pair<size_t, size_t> > location;     // contract -> (underlying, position)
+
+public:
+
+    // new underlying with spot S; returns its index
+    size_t AddUnderlying(double S);
+
+    // new contract on an existing underlying, priced at the underlying's spot
+    // (optData.S is ignored); returns its index
+    size_t Add(const OptionData& optData, size_t underlying);
+
+    // moves an underlying and reprices only the contracts on it
+    void Update(size_t underlying, double S);
+
+    double Spot(size_t underlying) const;
+
+    double Price(size_t contract) const;
+    OptionGreeks Greeks(size_t contract) const;
+
+    // prices of all contracts in the order they were added
+    vector<double> Prices() const;
+
+    size_t size() const
+    {
+        return location.size();
+    }
+};
+
+
+#endif /* CompiledOption_hpp */
@@ -136,6 +136,69 @@ double EuropeanOption::putGamma() const
     return callGamma();
 }
 
+// All greeks at once: the expensive terms are computed a single time
+// and every greek is a few multiplications on top of them
+OptionGreeks EuropeanOption::Greeks() const
+{
+    boost::math::normal_distribution<> N(0, 1); // standard normal distrubution
+    
+    // Getting individual data memebers of struct OptionData for computation purposes
+    OptionData data = getOptionData();
+    double S = data.S;
+    double K = data.K;
+    double r = data.r;
+    double b = data.b;
+    double sig = data.sig;
+    double T = data.T;
+    
+    // shared intermediates
+    double sqrtT = sqrt(T);
+    double sigSqrtT = sig * sqrtT;
+    double d1 = (log(S/K) + (b + ((sig * sig)/2)) * T) / sigSqrtT;
+    double d2 = d1 - sigSqrtT;
+    
+    double Nd1 = cdf(N, d1);
+    double Nd2 = cdf(N, d2);
+    double nd1 = norm_pdf(d1);
+    
+    double carryDiscount = exp((b - r) * T);    // e^((b-r)T)
+    double discount = exp(-r * T);              // e^(-rT)
+    
+    double SD = S * carryDiscount;              // discounted forward
+    double KD = K * discount;                   // discounted strike
+    
+    OptionGreeks g;
+    
+    // same for calls and puts
+    g.gamma = nd1 * carryDiscount / (S * sigSqrtT);
+    g.vega = SD * nd1 * sqrtT;
+    double timeDecay = -SD * nd1 * sig / (2 * sqrtT);
+    
+    if(data.oType == 0)
+    {
+        g.price = SD * Nd1 - KD * Nd2;
+        g.delta = carryDiscount * Nd1;
+        g.theta = timeDecay - (b - r) * SD * Nd1 - r * KD * Nd2;
+        g.rho = T * KD * Nd2;
+        g.carry = T * SD * Nd1;
+    }
+    else
+    {
+        // N(-d) = 1 - N(d)
+        double Nmd1 = 1 - Nd1;
+        double Nmd2 = 1 - Nd2;
+        
+        g.price = KD * Nmd2 - SD * Nmd1;
+        g.delta = carryDiscount * (Nd1 - 1);
+        g.theta = timeDecay + (b - r) * SD * Nmd1 + r * KD * Nmd2;
+        g.rho = -T * KD * Nmd2;
+        g.carry = -T * SD * Nmd1;
+    }
+    
+    return g;
+}
+
+
 // Divided differece methods:
 
 // double h is our step size for calculation
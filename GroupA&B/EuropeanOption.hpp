@@ -22,6 +22,22 @@
 using namespace std;
 
 
+// Price and full set of sensitivities of a European option.
+// theta is the change in value as calendar time passes (-dV/dT),
+// rho is with respect to r with the yield r - b held fixed (b moves with r),
+// carry is with respect to b alone.
+struct OptionGreeks
+{
+    double price;
+    double delta;
+    double gamma;
+    double vega;
+    double theta;
+    double rho;
+    double carry;
+};
+
+
 class EuropeanOption : public Option
 {
     
@@ -75,9 +91,9 @@ public:
         
         double d2 = d1 - (sig * sqrt(T));
         
-        // computing call price using black scholes where b = r
-        // therefore e^*(b-r)*T) becomes 1
-        double C = S * cdf(N, d1) - K * exp(-r * T) * cdf(N, d2);
+        // computing call price using the generalised black scholes formula,
+        // where e^((b-r)*T) is 1 for a stock without dividends (b = r)
+        double C = S * exp((b - r) * T) * cdf(N, d1) - K * exp(-r * T) * cdf(N, d2);
         
         return C;
         
@@ -101,8 +117,8 @@ public:
         
         double d2 = d1 - (sig * sqrt(T));
         
-        // computing put price
-        double P = K * exp(-r * T) * cdf(N, -d2) - S * cdf(N, -d1);
+        // computing put price using the generalised black scholes formula
+        double P = K * exp(-r * T) * cdf(N, -d2) - S * exp((b - r) * T) * cdf(N, -d1);
         
         return P;
         
@@ -127,6 +143,11 @@ public:
     double putGamma() const;
     
     
+    // price and all greeks from one evaluation of d1, d2, N(d1), N(d2),
+    // n(d1) and the discount factors; the price is the same as Price()
+    OptionGreeks Greeks() const;
+    
+    
     // greeks using divided difference methods
     double ddmDelta(double h) const;
     double ddmGamma(double h) const;
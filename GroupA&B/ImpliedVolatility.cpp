@@ -0,0 +1,263 @@
+//
+//  ImpliedVolatility.cpp
+//  GroupA&B
+//
+
+#include "ImpliedVolatility.hpp"
+
+#include <cmath>
+#include <limits>
+#include <vector>
+
+using namespace std;
+
+
+// Tolerance on the relative change in s = sig * sqrt(T)
+const double IV_TOLERANCE = 1.0e-12;
+
+// Lock-step iterations in the batch solver and the limit for a single option
+const int IV_BATCH_ITERATIONS = 3;
+const int IV_MAX_ITERATIONS = 12;
+
+
+// standard normal cdf and pdf without constructing a boost distribution
+static inline double ncdf(double x)
+{
+    return 0.5 * erfc(-x * M_SQRT1_2);
+}
+
+static inline double npdf(double x)
+{
+    return exp(-0.5 * x * x) / sqrt(2.0 * M_PI);
+}
+
+
+// Normalised Black call price exp(x/2) N(d1) - exp(-x/2) N(d2) for x <= 0
+static inline double normalisedCall(double x, double s)
+{
+    double d1 = x / s + 0.5 * s;
+    double d2 = d1 - s;
+
+    return exp(0.5 * x) * ncdf(d1) - exp(-0.5 * x) * ncdf(d2);
+}
+
+
+// Reduced problem: find s such that normalisedCall(x, s) = beta, x <= 0
+struct ReducedProblem
+{
+    double x;       // -|log(F/K)|
+    double beta;    // out-of-the-money normalised price
+    double sqrtT;
+    bool valid;     // price inside the no-arbitrage bounds
+};
+
+
+static inline ReducedProblem reduce(double price, double S, double K, double T, double r, double b, int oType)
+{
+    ReducedProblem p;
+
+    double F = S * exp(b * T);      // forward price
+    double theta = (oType == 0) ? 1.0 : -1.0;
+    double x = log(F / K);
+
+    // undiscounted price in units of sqrt(FK)
+    double beta = price * exp(r * T) / sqrt(F * K);
+
+    // subtract the intrinsic value of an in-the-money option (put-call parity)
+    double intrinsic = theta * (exp(0.5 * x) - exp(-0.5 * x));
+    if(intrinsic > 0)
+    {
+        beta -= intrinsic;
+    }
+
+    p.x = -fabs(x);
+    p.beta = beta;
+    p.sqrtT = sqrt(T);
+    p.valid = (beta > 0) && (beta < exp(0.5 * p.x)) && (T > 0);
+
+    return p;
+}
+
+
+// Initial guess. Near the money the Corrado-Miller formula is accurate; far
+// out of the money the asymptotic expansion
+// log(beta) = log(n(0) s^3 / x^2) - x^2 / (2 s^2), solved by fixed point, is
+// better. Both are evaluated and the one closer to beta in log terms is kept.
+static inline double initialGuess(const ReducedProblem& p)
+{
+    double x = p.x;
+    double beta = p.beta;
+    double logBeta = log(beta);
+
+    // Corrado-Miller with S -> exp(x/2), K -> exp(-x/2)
+    double half = 0.5 * (exp(0.5 * x) - exp(-0.5 * x));
+    double a = beta - half;
+    double disc = fmax(a * a - 4.0 * half * half / M_PI, 0.0);
+    double sCM = sqrt(2.0 * M_PI) / (exp(0.5 * x) + exp(-0.5 * x)) * (a + sqrt(disc));
+
+    if(x == 0 || logBeta >= 0)
+    {
+        return sCM;
+    }
+
+    double sAsym = fabs(x) / sqrt(-2.0 * logBeta);
+
+    for(int i = 0; i < 2; i++)
+    {
+        double arg = log(sAsym * sAsym * sAsym / (sqrt(2.0 * M_PI) * x * x)) - logBeta;
+        if(arg > 0)
+        {
+            sAsym = fabs(x) / sqrt(2.0 * arg);
+        }
+    }
+
+    double errCM = (sCM > 0) ? fabs(log(normalisedCall(x, sCM)) - logBeta) : numeric_limits<double>::infinity();
+    double errAsym = fabs(log(normalisedCall(x, sAsym)) - logBeta);
+
+    return (errCM <= errAsym) ? sCM : sAsym;
+}
+
+
+// One third order Householder step; returns the new s
+static inline double householderStep(double x, double beta, double s, double& step)
+{
+    double b = normalisedCall(x, s);
+    double d1 = x / s + 0.5 * s;
+
+    double vega = exp(0.5 * x) * npdf(d1);              // b'
+    double h2 = x * x / (s * s * s) - 0.25 * s;         // b'' / b'
+    double h3 = h2 * h2 - 3.0 * x * x / (s * s * s * s) - 0.25;   // b''' / b'
+
+    double nu;
+    if(beta < b * 0.5 || b < beta * 0.5 || s * s < 2.0 * fabs(x))
+    {
+        // log objective: f = log(b) - log(beta)
+        double g = vega / b;
+        nu = -(log(b) - log(beta)) / g;
+        h3 = h3 - 3.0 * h2 * g + 2.0 * g * g;
+        h2 = h2 - g;
+    }
+    else
+    {
+        nu = -(b - beta) / vega;
+    }
+
+    step = nu * (1.0 + 0.5 * h2 * nu) / (1.0 + nu * (h2 + h3 * nu / 6.0));
+
+    // fall back to Newton when the higher order terms reverse or blow up the step
+    if(!(step * nu > 0) || fabs(step) > 2.0 * fabs(nu))
+    {
+        step = nu;
+    }
+
+    // stay positive
+    double sNew = s + step;
+    if(sNew <= 0)
+    {
+        sNew = 0.5 * s;
+    }
+
+    return sNew;
+}
+
+
+static double solveReduced(const ReducedProblem& p, double s, int maxIterations, int* iterations)
+{
+    int i = 0;
+    double step = 1;
+
+    while(i < maxIterations && fabs(step) > IV_TOLERANCE * s)
+    {
+        s = householderStep(p.x, p.beta, s, step);
+        i++;
+    }
+
+    if(iterations)
+    {
+        *iterations = i;
+    }
+
+    return s;
+}
+
+
+double ImpliedVolatility(double marketPrice, const OptionData& optData, int* iterations)
+{
+    ReducedProblem p = reduce(marketPrice, optData.S, optData.K, optData.T, optData.r, optData.b, optData.oType);
+
+    if(!p.valid)
+    {
+        if(iterations)
+        {
+            *iterations = 0;
+        }
+
+        return numeric_limits<double>::quiet_NaN();
+    }
+
+    double s = solveReduced(p, initialGuess(p), IV_MAX_ITERATIONS, iterations);
+
+    return s / p.sqrtT;
+}
+
+
+void ImpliedVolatility(const OptionChain& chain, double* vol)
+{
+    size_t n = chain.size();
+
+    vector<double> x(n), beta(n), sqrtT(n), s(n), step(n);
+    vector<char> valid(n);
+
+    // pass 1: reduce every contract and make the initial guess
+    for(size_t i = 0; i < n; i++)
+    {
+        ReducedProblem p = reduce(chain.price[i], chain.S[i], chain.K[i], chain.T[i], chain.r[i], chain.b[i], chain.oType[i]);
+
+        x[i] = p.x;
+        beta[i] = p.valid ? p.beta : 0.5 * exp(0.5 * p.x);    // harmless dummy problem
+        sqrtT[i] = p.sqrtT;
+        valid[i] = p.valid;
+        s[i] = initialGuess(p);
+    }
+
+    // pass 2: fixed number of Householder iterations over all contracts; the
+    // loop body has no early exits so it runs in lock-step over the columns
+    for(int k = 0; k < IV_BATCH_ITERATIONS; k++)
+    {
+        for(size_t i = 0; i < n; i++)
+        {
+            s[i] = householderStep(x[i], beta[i], s[i], step[i]);
+        }
+    }
+
+    // pass 3: finish the stragglers and scale back to volatility
+    for(size_t i = 0; i < n; i++)
+    {
+        if(!valid[i])
+        {
+            vol[i] = numeric_limits<double>::quiet_NaN();
+            continue;
+        }
+
+        if(fabs(step[i]) > IV_TOLERANCE * s[i])
+        {
+            ReducedProblem p = {x[i], beta[i], sqrtT[i], true};
+            s[i] = solveReduced(p, s[i], IV_MAX_ITERATIONS - IV_BATCH_ITERATIONS, nullptr);
+        }
+
+        vol[i] = s[i] / sqrtT[i];
+    }
+}
+
+
+vector<double> ImpliedVolatility(const OptionChain& chain)
+{
+    vector<double> vol(chain.size());
+
+    if(!vol.empty())
+    {
+        ImpliedVolatility(chain, &vol[0]);
+    }
+
+    return vol;
+}
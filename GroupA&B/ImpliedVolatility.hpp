@@ -0,0 +1,54 @@
+//
+//  ImpliedVolatility.hpp
+//  GroupA&B
+//
+
+// Implied volatility for European options under the generalised Black-Scholes
+// model (cost of carry b). The price is normalised to the Black model
+// in terms of x = log(F/K) and s = sig * sqrt(T), reduced to an out-of-the-money
+// call and then solved with a third order Householder iteration on
+// a rational initial guess. In the deep out-of-the-money region we iterate on
+// log(price) which is close to linear in 1/s, so that two or three iterations
+// are enough everywhere.
+
+#ifndef ImpliedVolatility_hpp
+#define ImpliedVolatility_hpp
+
+#include <vector>
+#include <cstddef>
+
+#include "Option.hpp"
+
+using namespace std;
+
+
+// Columnar option chain; all columns have the same length
+struct OptionChain
+{
+    vector<double> price;   // market price
+    vector<double> S;       // underlying price
+    vector<double> K;       // strike price
+    vector<double> T;       // expiry time
+    vector<double> r;       // risk free interest rate
+    vector<double> b;       // cost of carry
+    vector<int> oType;      // option type, 0 for call, -1 for put
+    
+    size_t size() const { return price.size(); }
+};
+
+
+// Implied volatility of a single option; optData.sig is ignored.
+// Returns NaN when the price violates the no-arbitrage bounds.
+// If iterations is given it receives the number of Householder steps taken.
+double ImpliedVolatility(double marketPrice, const OptionData& optData, int* iterations = nullptr);
+
+// Implied volatility of a whole chain. All contracts run the same fixed
+// number of iterations in lock-step over contiguous arrays; contracts that
+// have not converged by then are finished one by one.
+vector<double> ImpliedVolatility(const OptionChain& chain);
+
+// As above, writing into an existing array of chain.size() elements
+void ImpliedVolatility(const OptionChain& chain, double* vol);
+
+
+#endif /* ImpliedVolatility_hpp */
@@ -0,0 +1,121 @@
+//
+//  Mesh.hpp
+//  GroupA&B
+//
+
+
+// Uniform mesh of points that are computed when they are needed instead of
+// being stored. Point i is start + i * h and the last point is exactly the
+// end of the mesh, so the number of points never depends on rounding and a
+// sweep over a very large mesh needs no memory for it.
+//
+// The sweep functions in main.cpp take a Mesh or a vector<double> alike.
+
+#ifndef Mesh_hpp
+#define Mesh_hpp
+
+#include <cmath>
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+using namespace std;
+
+
+class Mesh
+{
+
+private:
+    double first;   // first point
+    double last;    // last point
+    long steps;     // number of intervals, so steps + 1 points
+
+public:
+
+    // iterator for range based for loops and the standard algorithms
+    class Iterator
+    {
+    private:
+        const Mesh* mesh;
+        long index;
+
+    public:
+        typedef std::random_access_iterator_tag iterator_category;
+        typedef double value_type;
+        typedef std::ptrdiff_t difference_type;
+        typedef const double* pointer;
+        typedef double reference;
+
+        Iterator() : mesh(0), index(0) {}
+        Iterator(const Mesh* m, long i) : mesh(m), index(i) {}
+
+        double operator*() const { return (*mesh)[index]; }
+        double operator[](difference_type k) const { return (*mesh)[index + long(k)]; }
+
+        Iterator& operator++() { ++index; return *this; }
+        Iterator& operator--() { --index; return *this; }
+        Iterator operator++(int) { Iterator old(*this); ++index; return old; }
+        Iterator operator--(int) { Iterator old(*this); --index; return old; }
+
+        Iterator& operator+=(difference_type k) { index += long(k); return *this; }
+        Iterator& operator-=(difference_type k) { index -= long(k); return *this; }
+        Iterator operator+(difference_type k) const { return Iterator(mesh, index + long(k)); }
+        Iterator operator-(difference_type k) const { return Iterator(mesh, index - long(k)); }
+        friend Iterator operator+(difference_type k, const Iterator& it) { return it + k; }
+        difference_type operator-(const Iterator& other) const { return index - other.index; }
+
+        bool operator==(const Iterator& other) const { return index == other.index; }
+        bool operator!=(const Iterator& other) const { return index != other.index; }
+        bool operator<(const Iterator& other) const { return index < other.index; }
+        bool operator>(const Iterator& other) const { return index > other.index; }
+        bool operator<=(const Iterator& other) const { return index <= other.index; }
+        bool operator>=(const Iterator& other) const { return index >= other.index; }
+    };
+
+
+    // Mesh of steps + 1 points from start to end, both included
+    Mesh(double start, double end, long numSteps) : first(start), last(end), steps(numSteps) {}
+
+
+    // points start, start + increment, ... up to and including end;
+    // end counts as reached when it is within a small tolerance of a whole
+    // number of increments, which is where the old accumulating loop lost it
+    static Mesh FromIncrement(double start, double end, double increment)
+    {
+        double intervals = (end - start) / increment;
+        long n = long(floor(intervals + 1.0e-9));
+
+        if (n < 0)
+        {
+            // no point lies in the range; keep the start point alone
+            return Mesh(start, start, 0);
+        }
+
+        double lastPoint = (fabs(intervals - double(n)) < 1.0e-9) ? end : start + double(n) * increment;
+
+        return Mesh(start, lastPoint, n);
+    }
+
+
+    // point i, computed directly and never accumulated
+    double operator[](long i) const
+    {
+        if (i <= 0) return first;
+        if (i >= steps) return last;
+
+        return first + (last - first) * (double(i) / double(steps));
+    }
+
+    size_t size() const { return size_t(steps + 1); }
+    double front() const { return first; }
+    double back() const { return last; }
+
+    Iterator begin() const { return Iterator(this, 0); }
+    Iterator end() const { return Iterator(this, steps + 1); }
+
+    // stored copy of the points, for code that needs a vector
+    vector<double> toVector() const { return vector<double>(begin(), end()); }
+};
+
+
+#endif /* Mesh_hpp */
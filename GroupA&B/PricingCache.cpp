@@ -0,0 +1,393 @@
+//
+//  PricingCache.cpp
+//  GroupA&B
+//
+
+#include "PricingCache.hpp"
+
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+#include <mutex>
+
+using namespace std;
+
+
+// no entry / empty slot
+static const uint32_t NONE = 0xffffffff;
+
+
+// model and the bit patterns of the (quantized) OptionData fields;
+// +0 and -0 are different keys, which only costs a miss
+struct CacheKey
+{
+    uint64_t bits[7];
+};
+
+
+// a cached price and its links in the LRU list
+struct CacheEntry
+{
+    CacheKey key;
+    uint32_t hash;      // low bits of the key's hash, to find the entry's slot
+    uint32_t prev;      // towards the most recently used
+    uint32_t next;      // towards the least recently used
+    double price;
+};
+
+
+// hash table slot; the low hash bits filter probes before the keys are compared
+struct CacheSlot
+{
+    uint32_t entry;
+    uint32_t hash;
+};
+
+
+static inline uint64_t bitsOf(double x)
+{
+    uint64_t bits;
+    memcpy(&bits, &x, sizeof(bits));
+    return bits;
+}
+
+
+static inline CacheKey makeKey(const OptionData& q, PricingModel model)
+{
+    CacheKey key;
+
+    key.bits[0] = bitsOf(q.T);
+    key.bits[1] = bitsOf(q.K);
+    key.bits[2] = bitsOf(q.sig);
+    key.bits[3] = bitsOf(q.r);
+    key.bits[4] = bitsOf(q.S);
+    key.bits[5] = bitsOf(q.b);
+    key.bits[6] = (uint64_t(model) << 32) | uint32_t(q.oType);
+
+    return key;
+}
+
+
+// independent multiplies by odd constants, then the splitmix64 finaliser
+// to spread every input bit over the whole word
+static inline uint64_t hashKey(const CacheKey& key)
+{
+    uint64_t h = key.bits[0] * 0x9e3779b97f4a7c15ULL + key.bits[1] * 0xc2b2ae3d27d4eb4fULL
+                + key.bits[2] * 0x165667b19e3779f9ULL + key.bits[3] * 0xd6e8feb86659fd93ULL
+                + key.bits[4] * 0xff51afd7ed558ccdULL + key.bits[5] * 0xc4ceb9fe1a85ec53ULL
+                + key.bits[6] * 0x27d4eb2f165667c5ULL;
+
+    h ^= h >> 30;
+    h *= 0xbf58476d1ce4e5b9ULL;
+    h ^= h >> 27;
+    h *= 0x94d049bb133111ebULL;
+    h ^= h >> 31;
+
+    return h;
+}
+
+
+static inline bool operator == (const CacheKey& x, const CacheKey& y)
+{
+    return memcmp(x.bits, y.bits, sizeof(x.bits)) == 0;
+}
+
+
+// Linear probing table of at least twice the capacity, so probes stay short;
+// deletion shifts the following slots back instead of leaving tombstones.
+// Entries are allocated from one array and linked into the LRU list by index.
+struct alignas(64) PricingCache::Shard
+{
+    mutex lock;
+
+    vector<CacheSlot> table;
+    uint32_t mask;
+
+    vector<CacheEntry> entries;
+    size_t capacity;
+    uint32_t head;      // most recently used
+    uint32_t tail;      // least recently used
+
+    size_t hits;
+    size_t misses;
+    size_t evictions;
+
+
+    Shard(size_t cap) : capacity(cap), head(NONE), tail(NONE), hits(0), misses(0), evictions(0)
+    {
+        size_t size = 16;
+        while (size < 2 * capacity)
+        {
+            size *= 2;
+        }
+
+        table.assign(size, CacheSlot{ NONE, 0 });
+        mask = uint32_t(size - 1);
+        entries.reserve(capacity);
+    }
+
+
+    // entry holding key, or NONE
+    uint32_t find(const CacheKey& key, uint32_t hash) const
+    {
+        for (uint32_t i = hash & mask; table[i].entry != NONE; i = (i + 1) & mask)
+        {
+            if (table[i].hash == hash && entries[table[i].entry].key == key)
+            {
+                return table[i].entry;
+            }
+        }
+
+        return NONE;
+    }
+
+
+    void unlink(uint32_t e)
+    {
+        CacheEntry& x = entries[e];
+
+        if (x.prev != NONE) entries[x.prev].next = x.next; else head = x.next;
+        if (x.next != NONE) entries[x.next].prev = x.prev; else tail = x.prev;
+    }
+
+
+    void pushFront(uint32_t e)
+    {
+        entries[e].prev = NONE;
+        entries[e].next = head;
+
+        if (head != NONE) entries[head].prev = e; else tail = e;
+        head = e;
+    }
+
+
+    void touch(uint32_t e)
+    {
+        if (e != head)
+        {
+            unlink(e);
+            pushFront(e);
+        }
+    }
+
+
+    // removes the slot of entry e
+    void eraseSlot(uint32_t e)
+    {
+        uint32_t i = entries[e].hash & mask;
+        while (table[i].entry != e)
+        {
+            i = (i + 1) & mask;
+        }
+
+        // move back every following slot whose home is not between the hole and itself
+        for (uint32_t j = (i + 1) & mask; table[j].entry != NONE; j = (j + 1) & mask)
+        {
+            uint32_t home = table[j].hash & mask;
+
+            if (((j - home) & mask) >= ((j - i) & mask))
+            {
+                table[i] = table[j];
+                i = j;
+            }
+        }
+
+        table[i].entry = NONE;
+    }
+
+
+    // adds a price that is not in the table, evicting the least recently used when full
+    void insert(const CacheKey& key, uint32_t hash, double price)
+    {
+        uint32_t e;
+
+        if (entries.size() < capacity)
+        {
+            e = uint32_t(entries.size());
+            entries.push_back(CacheEntry());
+        }
+        else
+        {
+            e = tail;
+            eraseSlot(e);
+            unlink(e);
+            evictions++;
+        }
+
+        entries[e].key = key;
+        entries[e].hash = hash;
+        entries[e].price = price;
+        pushFront(e);
+
+        uint32_t i = hash & mask;
+        while (table[i].entry != NONE)
+        {
+            i = (i + 1) & mask;
+        }
+
+        table[i] = CacheSlot{ e, hash };
+    }
+
+
+    void clear()
+    {
+        table.assign(table.size(), CacheSlot{ NONE, 0 });
+        entries.clear();
+        head = tail = NONE;
+    }
+};
+
+
+PricingCache::PricingCache(size_t capacity, double sQuantum, double sigQuantum, size_t nShards)
+    : sQuantum(sQuantum), sigQuantum(sigQuantum)
+{
+    size_t n = 1;
+    while (n < nShards)
+    {
+        n *= 2;
+    }
+
+    capacityPerShard = max(size_t(1), (capacity + n - 1) / n);
+
+    for (size_t i = 0; i < n; i++)
+    {
+        shards.push_back(unique_ptr<Shard>(new Shard(capacityPerShard)));
+    }
+}
+
+
+PricingCache::~PricingCache()
+{
+}
+
+
+OptionData PricingCache::quantize(const OptionData& optData) const
+{
+    OptionData q = optData;
+
+    if (sQuantum > 0.0)
+    {
+        q.S = sQuantum * round(optData.S / sQuantum);
+    }
+
+    if (sigQuantum > 0.0)
+    {
+        // never round the volatility down to zero
+        q.sig = sigQuantum * max(1.0, round(optData.sig / sigQuantum));
+    }
+
+    return q;
+}
+
+
+double PricingCache::Price(const OptionData& optData, PricingModel model)
+{
+    OptionData q = quantize(optData);
+    CacheKey key = makeKey(q, model);
+
+    // the high bits pick the shard, the low bits the slot
+    uint64_t h = hashKey(key);
+    uint32_t hash = uint32_t(h);
+    Shard& shard = *shards[(h >> 48) & (shards.size() - 1)];
+
+    {
+        lock_guard<mutex> guard(shard.lock);
+
+        uint32_t e = shard.find(key, hash);
+        if (e != NONE)
+        {
+            shard.hits++;
+            shard.touch(e);
+            return shard.entries[e].price;
+        }
+
+        shard.misses++;
+    }
+
+    // priced without holding the lock
+    double price = (model == EuropeanModel) ? EuropeanOption(q).Price() : AmericanOption(q).Price();
+
+    lock_guard<mutex> guard(shard.lock);
+
+    // another thread may have priced the same contract in the meantime
+    if (shard.find(key, hash) == NONE)
+    {
+        shard.insert(key, hash, price);
+    }
+
+    return price;
+}
+
+
+double PricingCache::Price(const EuropeanOption& option)
+{
+    return Price(option.getOptionData(), EuropeanModel);
+}
+
+
+double PricingCache::Price(const AmericanOption& option)
+{
+    return Price(option.getOptionData(), AmericanModel);
+}
+
+
+void PricingCache::Price(const vector<OptionData>& book, PricingModel model, double* price)
+{
+    for (size_t i = 0; i < book.size(); i++)
+    {
+        price[i] = Price(book[i], model);
+    }
+}
+
+
+vector<double> PricingCache::Price(const vector<OptionData>& book, PricingModel model)
+{
+    vector<double> price(book.size());
+
+    if (!book.empty())
+    {
+        Price(book, model, &price[0]);
+    }
+
+    return price;
+}
+
+
+CacheStatistics PricingCache::Statistics() const
+{
+    CacheStatistics stats = { 0, 0, 0, 0 };
+
+    for (size_t i = 0; i < shards.size(); i++)
+    {
+        lock_guard<mutex> guard(shards[i]->lock);
+
+        stats.hits += shards[i]->hits;
+        stats.misses += shards[i]->misses;
+        stats.evictions += shards[i]->evictions;
+        stats.size += shards[i]->entries.size();
+    }
+
+    return stats;
+}
+
+
+void PricingCache::ResetStatistics()
+{
+    for (size_t i = 0; i < shards.size(); i++)
+    {
+        lock_guard<mutex> guard(shards[i]->lock);
+
+        shards[i]->hits = shards[i]->misses = shards[i]->evictions = 0;
+    }
+}
+
+
+void PricingCache::Clear()
+{
+    for (size_t i = 0; i < shards.size(); i++)
+    {
+        lock_guard<mutex> guard(shards[i]->lock);
+
+        shards[i]->clear();
+    }
+}
@@ -0,0 +1,108 @@
+//
+//  PricingCache.hpp
+//  GroupA&B
+//
+
+// Memoizing cache in front of EuropeanOption and AmericanOption. A quoting
+// loop that reprices a book where only a few contracts changed pays a hash
+// lookup for the unchanged ones instead of a Black-Scholes evaluation.
+//
+// The key is the model plus every field of OptionData. S and sig can be
+// quantized to a grid (0 = exact): an option is then priced at the nearest
+// grid point, so every input in a bucket gets the same price and the error
+// is at most about delta * dS / 2 + vega * dsig / 2.
+//
+// The cache is split into shards, each with its own lock, open addressing
+// table and LRU list, so threads pricing different contracts rarely wait on
+// each other. A hit is one hash, one probe and relinking the entry at the
+// front of the list; entries live in one array per shard, so the cache does
+// not allocate once full. Eviction is least recently used within a shard.
+// Misses are priced outside the lock.
+
+#ifndef PricingCache_hpp
+#define PricingCache_hpp
+
+#include <cstddef>
+#include <memory>
+#include <vector>
+
+#include "Option.hpp"
+#include "EuropeanOption.hpp"
+#include "AmericanOption.hpp"
+
+using namespace std;
+
+
+// pricer behind a cached value
+enum PricingModel
+{
+    EuropeanModel,
+    AmericanModel
+};
+
+
+// counters since construction or the last ResetStatistics()
+struct CacheStatistics
+{
+    size_t hits;
+    size_t misses;
+    size_t evictions;
+    size_t size;        // entries currently held
+
+    double HitRate() const
+    {
+        return (hits + misses > 0) ? double(hits) / double(hits + misses) : 0.0;
+    }
+};
+
+
+class PricingCache
+{
+private:
+
+    // lock, hash table and LRU list of one part of the key space (PricingCache.cpp)
+    struct Shard;
+
+    size_t capacityPerShard;
+    double sQuantum;
+    double sigQuantum;
+    vector<unique_ptr<Shard> > shards;
+
+    OptionData quantize(const OptionData& optData) const;
+
+public:
+
+    // capacity is the total number of prices held; sQuantum and sigQuantum
+    // are the grid spacings of S and sig (0 keys on the exact value);
+    // nShards is rounded up to a power of two
+    PricingCache(size_t capacity = 100000, double sQuantum = 0.0, double sigQuantum = 0.0, size_t nShards = 16);
+
+    ~PricingCache();
+
+    PricingCache(const PricingCache&) = delete;
+    PricingCache& operator = (const PricingCache&) = delete;
+
+
+    // cached price; computed with the model's Price() on a miss
+    double Price(const OptionData& optData, PricingModel model);
+
+    double Price(const EuropeanOption& option);
+    double Price(const AmericanOption& option);
+
+
+    // prices of a whole book
+    vector<double> Price(const vector<OptionData>& book, PricingModel model);
+
+    // as above, writing into an existing array of book.size() elements
+    void Price(const vector<OptionData>& book, PricingModel model, double* price);
+
+
+    CacheStatistics Statistics() const;
+    void ResetStatistics();
+
+    // drops all entries; the counters are kept
+    void Clear();
+};
+
+
+#endif /* PricingCache_hpp */
@@ -0,0 +1,171 @@
+//
+//  TaylorRepricer.cpp
+//  GroupA&B
+//
+
+#include "TaylorRepricer.hpp"
+
+#include <cmath>
+#include <stdexcept>
+#include <string>
+
+using namespace std;
+
+
+TaylorRepricer::TaylorRepricer(double tolerance, double maxRelativeMove)
+    : tolerance(tolerance), maxRelativeMove(maxRelativeMove)
+{
+    stats.approximate = stats.exact = 0;
+}
+
+
+double TaylorRepricer::anchor(size_t i, double S, double sig)
+{
+    OptionData& data = contracts[i];
+    data.S = S;
+    data.sig = sig;
+
+    OptionGreeks g = EuropeanOption(data).Greeks();
+
+    double sigSqrtT = sig * sqrt(data.T);
+    double d1 = (log(S / data.K) + (data.b + 0.5 * sig * sig) * data.T) / sigSqrtT;
+    double d2 = d1 - sigSqrtT;
+
+    S0[i] = S;
+    sig0[i] = sig;
+    P0[i] = g.price;
+
+    delta[i] = g.delta;
+    gamma[i] = g.gamma;
+    vega[i] = g.vega;
+
+    // the same for calls and puts
+    vanna[i] = -g.vega * d2 / (S * sigSqrtT);
+    volga[i] = g.vega * d1 * d2 / sig;
+    speed[i] = -g.gamma / S * (1.0 + d1 / sigSqrtT);
+
+    errorEstimate[i] = 0.0;
+
+    return g.price;
+}
+
+
+size_t TaylorRepricer::Add(const OptionData& optData)
+{
+    contracts.push_back(optData);
+
+    S0.push_back(0.0);
+    sig0.push_back(0.0);
+    P0.push_back(0.0);
+    delta.push_back(0.0);
+    gamma.push_back(0.0);
+    vega.push_back(0.0);
+    vanna.push_back(0.0);
+    volga.push_back(0.0);
+    speed.push_back(0.0);
+    errorEstimate.push_back(0.0);
+
+    anchor(contracts.size() - 1, optData.S, optData.sig);
+
+    return contracts.size() - 1;
+}
+
+
+double TaylorRepricer::Reprice(size_t contract, double S, double sig)
+{
+    if (contract >= contracts.size())
+    {
+        throw out_of_range("TaylorRepricer::Reprice: no such contract");
+    }
+
+    size_t i = contract;
+    double dS = S - S0[i];
+    double dsig = sig - sig0[i];
+
+    errorEstimate[i] = fabs(vanna[i] * dS * dsig) + fabs(0.5 * volga[i] * dsig * dsig)
+                        + fabs(speed[i] * dS * dS * dS / 6.0);
+
+    if (errorEstimate[i] > tolerance || fabs(dS) > maxRelativeMove * S0[i])
+    {
+        stats.exact++;
+        return anchor(i, S, sig);
+    }
+
+    stats.approximate++;
+    return P0[i] + dS * (delta[i] + 0.5 * gamma[i] * dS) + vega[i] * dsig;
+}
+
+
+void TaylorRepricer::Reprice(const double* S, const double* sig, double* price)
+{
+    size_t n = contracts.size();
+
+    // pass 1: expansion and error estimate for every contract, no branches
+    for (size_t i = 0; i < n; i++)
+    {
+        double dS = S[i] - S0[i];
+        double dsig = sig[i] - sig0[i];
+
+        price[i] = P0[i] + dS * (delta[i] + 0.5 * gamma[i] * dS) + vega[i] * dsig;
+
+        errorEstimate[i] = fabs(vanna[i] * dS * dsig) + fabs(0.5 * volga[i] * dsig * dsig)
+                            + fabs(speed[i] * dS * dS * dS / 6.0);
+    }
+
+    // pass 2: exact prices where the expansion cannot be trusted
+    fallback.clear();
+
+    for (size_t i = 0; i < n; i++)
+    {
+        if (errorEstimate[i] > tolerance || fabs(S[i] - S0[i]) > maxRelativeMove * S0[i])
+        {
+            fallback.push_back(i);
+        }
+    }
+
+    for (size_t k = 0; k < fallback.size(); k++)
+    {
+        size_t i = fallback[k];
+        price[i] = anchor(i, S[i], sig[i]);
+    }
+
+    stats.exact += fallback.size();
+    stats.approximate += n - fallback.size();
+}
+
+
+vector<double> TaylorRepricer::Reprice(const vector<double>& S, const vector<double>& sig)
+{
+    if (S.size() != contracts.size() || sig.size() != contracts.size())
+    {
+        throw invalid_argument("TaylorRepricer::Reprice: need one S and one sig per contract");
+    }
+
+    vector<double> price(contracts.size());
+
+    if (!price.empty())
+    {
+        Reprice(&S[0], &sig[0], &price[0]);
+    }
+
+    return price;
+}
+
+
+void TaylorRepricer::Rebase(double dt)
+{
+    // checked first, so a rejected dt leaves the book as it was
+    for (size_t i = 0; i < contracts.size(); i++)
+    {
+        if (contracts[i].T - dt <= 0.0)
+        {
+            throw invalid_argument("TaylorRepricer::Rebase: dt reaches the expiry of contract " + to_string(i));
+        }
+    }
+
+    for (size_t i = 0; i < contracts.size(); i++)
+    {
+        contracts[i].T -= dt;
+        anchor(i, S0[i], sig0[i]);
+    }
+}
@@ -0,0 +1,108 @@
+//
+//  TaylorRepricer.hpp
+//  GroupA&B
+//
+
+// Approximate repricing of a European book for small moves in S and sig.
+// Each contract keeps an anchor: an exact EuropeanOption::Greeks() at the
+// S and sig where it was last priced exactly. A tick is priced from the anchor
+// with the delta-gamma-vega expansion
+//
+//      P = P0 + delta dS + gamma dS^2 / 2 + vega dsig
+//
+// and the leading terms it leaves out give the error estimate
+//
+//      |vanna dS dsig| + |volga dsig^2 / 2| + |speed dS^3 / 6|
+//
+// (vanna, volga and speed are computed once at the anchor). A contract whose
+// estimate exceeds the tolerance, or whose S moved more than maxRelativeMove
+// from its anchor, is priced exactly and re-anchored there.
+//
+// Prices are those of the generalised Black-Scholes formula, as Greeks().
+// T, K, r and b are fixed; to roll time, Rebase() the book.
+
+#ifndef TaylorRepricer_hpp
+#define TaylorRepricer_hpp
+
+#include <cstddef>
+#include <vector>
+
+#include "Option.hpp"
+#include "EuropeanOption.hpp"
+
+using namespace std;
+
+
+// contracts priced by each method since construction or the last ResetStatistics()
+struct RepriceStatistics
+{
+    size_t approximate;
+    size_t exact;
+};
+
+
+class TaylorRepricer
+{
+private:
+    double tolerance;
+    double maxRelativeMove;
+
+    vector<OptionData> contracts;
+
+    // anchor, one array per term so that a tick is a loop over contiguous data
+    vector<double> S0, sig0, P0;
+    vector<double> delta, gamma, vega;
+    vector<double> vanna, volga, speed;
+
+    vector<double> errorEstimate;     // of the last reprice; 0 when it was exact
+    vector<size_t> fallback;          // work array of the book reprice
+
+    RepriceStatistics stats;
+
+    // exact price at (S, sig), which becomes the anchor of contract i
+    double anchor(size_t i, double S, double sig);
+
+public:
+
+    // tolerance is the largest accepted error estimate (in price units)
+    TaylorRepricer(double tolerance = 1.0e-3, double maxRelativeMove = 0.05);
+
+    // adds a contract, anchored at its own S and sig; returns its index
+    size_t Add(const OptionData& optData);
+
+    // price of one contract at (S, sig)
+    double Reprice(size_t contract, double S, double sig);
+
+    // prices of the whole book; S and sig have size() elements
+    vector<double> Reprice(const vector<double>& S, const vector<double>& sig);
+
+    // as above with raw arrays, writing into an existing array of size() elements
+    void Reprice(const double* S, const double* sig, double* price);
+
+    // re-anchors every contract exactly, with time to expiry reduced by dt;
+    // throws invalid_argument if dt reaches the expiry of a contract
+    void Rebase(double dt = 0.0);
+
+    double ErrorEstimate(size_t contract) const
+    {
+        return errorEstimate.at(contract);
+    }
+
+    RepriceStatistics Statistics() const
+    {
+        return stats;
+    }
+
+    void ResetStatistics()
+    {
+        stats.approximate = stats.exact = 0;
+    }
+
+    size_t size() const
+    {
+        return contracts.size();
+    }
+};
+
+
+#endif /* TaylorRepricer_hpp */
@@ -7,30 +7,33 @@
 
 #include "EuropeanOption.hpp"
 #include "AmericanOption.hpp"
+#include "ImpliedVolatility.hpp"
+#include "AmericanApproximation.hpp"
+#include "PricingCache.hpp"
+#include "CompiledOption.hpp"
+#include "TaylorRepricer.hpp"
+#include "Mesh.hpp"
 #include <vector>
+#include <stdexcept>
 
 using namespace std;
 
 // global function generates mesh array to compute range of option prices
-// given range of prices for underlying stock
+// given range of prices for underlying stock; the points are computed by
+// Mesh, so adding up increments can no longer drop the end point
 vector<double> CreateMesh(double start, double end, double increment)
 {
-    vector<double> meshArray;
-    
-    for(double i = start; i <= end; i += increment)
-    {
-        meshArray.push_back(i);
-    }
-    
-    return meshArray;
+    return Mesh::FromIncrement(start, end, increment).toVector();
 }
 
 
 // function that uses an array of underlying stock prices
-// to compute array of option prices
-vector<double> calculateOptionPriceEuropean(vector<double> underlyingPrice, const EuropeanOption& source)
+// to compute array of option prices; any mesh works, a Mesh or a vector<double>
+template <class MeshType>
+vector<double> calculateOptionPriceEuropean(const MeshType& underlyingPrice, const EuropeanOption& source)
 {
     vector<double> priceArray;
+    priceArray.reserve(underlyingPrice.size());
     
     
     
@@ -46,9 +49,11 @@ vector<double> calculateOptionPriceEuropean(vector<double> underlyingPrice, cons
 
 // function that uses an array of underlying stock prices
 // to compute array of call delta prices
-vector<double> calculateCallOptionDelta(vector<double> underlyingPrice, const EuropeanOption& source)
+template <class MeshType>
+vector<double> calculateCallOptionDelta(const MeshType& underlyingPrice, const EuropeanOption& source)
 {
     vector<double> priceArray;
+    priceArray.reserve(underlyingPrice.size());
     
     
     
@@ -64,9 +69,11 @@ vector<double> calculateCallOptionDelta(vector<double> underlyingPrice, const Eu
 
 // function that uses an array of underlying stock prices
 // to compute array of put delta prices
-vector<double> calculatePutOptionDelta(vector<double> underlyingPrice, const EuropeanOption& source)
+template <class MeshType>
+vector<double> calculatePutOptionDelta(const MeshType& underlyingPrice, const EuropeanOption& source)
 {
     vector<double> priceArray;
+    priceArray.reserve(underlyingPrice.size());
     
     
     
@@ -80,9 +87,11 @@ vector<double> calculatePutOptionDelta(vector<double> underlyingPrice, const Eur
     return priceArray;
 }
 
-vector<double> calculateOptionPriceAmerican(vector<double> underlyingPrice, const AmericanOption& source)
+template <class MeshType>
+vector<double> calculateOptionPriceAmerican(const MeshType& underlyingPrice, const AmericanOption& source)
 {
     vector<double> priceArray;
+    priceArray.reserve(underlyingPrice.size());
     
     
     
@@ -100,21 +109,21 @@ vector<double> calculateOptionPriceAmerican(vector<double> underlyingPrice, cons
 // using put price to calculate call price
 double CallGivenPut(double putPrice, const OptionData& optData)
 {
-    return putPrice + optData.S - (optData.K * exp(-optData.r * optData.T));
+    return putPrice + optData.S * exp((optData.b - optData.r) * optData.T) - (optData.K * exp(-optData.r * optData.T));
 }
     
     
 // using call price to calculate put price
 double PutGivenCall(double callPrice, const OptionData& optData)
 {
-    return callPrice - optData.S + (optData.K * exp(-optData.r * optData.T));
+    return callPrice - optData.S * exp((optData.b - optData.r) * optData.T) + (optData.K * exp(-optData.r * optData.T));
 }
     
     
 // testing if a pair of call and put prices satisfy parity
 bool testParity(double callPrice, double putPrice, const OptionData& source, double tolerance)
 {
-    return abs( callPrice + source.K * exp(-source.r * source.T) - putPrice - source.S) < tolerance;
+    return abs( callPrice + source.K * exp(-source.r * source.T) - putPrice - source.S * exp((source.b - source.r) * source.T)) < tolerance;
 }
 
 
@@ -129,9 +138,11 @@ bool testParity(double callPrice, double putPrice, const OptionData& source, dou
 // according the user entered data
 // Hence the vector<double> testParameters modifies the required element of
 // each OptionData in our vector<OptionData>
-vector<OptionData> optionParameters(OptionData baseCase, vector<double> testParameters, int paramType)
+template <class MeshType>
+vector<OptionData> optionParameters(OptionData baseCase, const MeshType& testParameters, int paramType)
 {
     vector<OptionData> meshParameters;
+    meshParameters.reserve(testParameters.size());
     
     for(int i = 0; i < testParameters.size(); i++)
     {
@@ -310,8 +321,9 @@ int main()
     cout << endl << endl << endl;
      
     cout << "---------- Part C ----------" << endl;
-    // creating an array for calculating prices of ceu1 (call european option 1)
-    vector<double> underlyingPrice = CreateMesh(45, 80, 5);
+    // creating a mesh for calculating prices of ceu1 (call european option 1);
+    // the points are computed as the sweep asks for them
+    Mesh underlyingPrice = Mesh::FromIncrement(45, 80, 5);
     
     // computing the range of option prices and storing them in a vector according to
     // above global funtion
@@ -373,7 +385,13 @@ int main()
     cout << "Put Delta: " << callOptionTest.putDelta() << endl << endl;
     
     cout << "Call Gamma: " << callOptionTest.callGamma() << endl;
-    cout << "Put Gamma: " << callOptionTest.putGamma() << endl;
+    cout << "Put Gamma: " << callOptionTest.putGamma() << endl << endl;
+    
+    // full risk vector in one call
+    OptionGreeks risk = callOptionTest.Greeks();
+    
+    cout << "Call Price: " << risk.price << ", Delta: " << risk.delta << ", Gamma: " << risk.gamma
+         << ", Vega: " << risk.vega << ", Theta: " << risk.theta << ", Rho: " << risk.rho << ", Carry: " << risk.carry << endl;
     
 
     cout << endl << "---------- Part B----------" << endl;
@@ -492,6 +510,152 @@ int main()
     }
     
     
+    cout << endl << "---------- Implied volatility ---------" << endl;
+    
+    
+    // recovering the volatility from prices computed with a known volatility
+    OptionData ivData(0.5, 100, 0.3, 0.05, 100, 0.05, 0);
+    
+    int iterations;
+    double ivPrice = EuropeanOption(ivData).Price();
+    double iv = ImpliedVolatility(ivPrice, ivData, &iterations);
+    
+    cout << "Price: " << ivPrice << " => Implied volatility: " << iv << " (" << iterations << " iterations)" << endl;
+    
+    // a whole chain of strikes solved in one batch
+    OptionChain chain;
+    vector<double> strikes = CreateMesh(80, 120, 10);
+    
+    for(int i = 0; i < strikes.size(); i++)
+    {
+        OptionData d(0.5, strikes[i], 0.3, 0.05, 100, 0.05, -1);
+        
+        chain.price.push_back(EuropeanOption(d).Price());
+        chain.S.push_back(d.S);
+        chain.K.push_back(d.K);
+        chain.T.push_back(d.T);
+        chain.r.push_back(d.r);
+        chain.b.push_back(d.b);
+        chain.oType.push_back(d.oType);
+    }
+    
+    vector<double> chainVol = ImpliedVolatility(chain);
+    
+    for(int i = 0; i < chainVol.size(); i++)
+    {
+        cout << "Strike: " << chain.K[i] << " => Put price: " << chain.price[i] << " => Implied volatility: " << chainVol[i] << endl;
+    }
+    
+    cout << endl << "---------- Finite expiry American options ---------" << endl;
+    
+    
+    // BAW and Bjerksund-Stensland for a put as the underlying moves
+    OptionData amData(1.0, 100, 0.3, 0.08, 100, 0.03, -1);
+    
+    int bawIterations;
+    double Sc = BaroneAdesiWhaleyCriticalPrice(amData, &bawIterations);
+    
+    cout << "BAW critical price: " << Sc << " (" << bawIterations << " iterations)" << endl;
+    
+    vector<OptionData> amBook;
+    vector<double> amSpot = CreateMesh(60, 120, 20);
+    
+    for(int i = 0; i < amSpot.size(); i++)
+    {
+        amData.S = amSpot[i];
+        amBook.push_back(amData);
+    }
+    
+    // the boundary is computed once for the whole sweep
+    vector<double> bawPrices = BaroneAdesiWhaley(amBook);
+    vector<double> bsPrices = BjerksundStensland(amBook);
+    
+    for(int i = 0; i < amBook.size(); i++)
+    {
+        cout << "Given stock price: " << amBook[i].S << " => BAW put: " << bawPrices[i] << " => Bjerksund-Stensland put: " << bsPrices[i] << endl;
+    }
+    
+    cout << endl << "---------- Pricing cache ---------" << endl;
+    
+    
+    // quoting the same book twice; only the contracts whose inputs moved are priced again
+    PricingCache cache(10000);
+    vector<OptionData> quoteBook = optionParameters(cod1, CreateMesh(50, 70, 0.5), 5);
+    
+    vector<double> quotes = cache.Price(quoteBook, EuropeanModel);
+    
+    quoteBook[0].S += 0.25;
+    quoteBook[1].S += 0.25;
+    quotes = cache.Price(quoteBook, EuropeanModel);
+    
+    CacheStatistics stats = cache.Statistics();
+    
+    cout << "Contracts: " << quoteBook.size() << " => Hits: " << stats.hits << " => Misses: " << stats.misses
+         << " => Hit rate: " << stats.HitRate() << endl;
+    
+    cout << endl << "---------- Compiled options ---------" << endl;
+    
+    
+    // a book on two underlyings; a quote on one reprices only its contracts
+    CompiledBook book;
+    size_t stockA = book.AddUnderlying(60);
+    size_t stockB = book.AddUnderlying(100);
+    
+    for(int i = 0; i < strikes.size(); i++)
+    {
+        book.Add(OptionData(0.5, strikes[i], 0.3, 0.05, 0, 0.05, 0), stockB);
+    }
+    
+    book.Add(cod1, stockA);
+    book.Add(pod1, stockA);
+    
+    book.Update(stockB, 101);
+    
+    vector<double> bookPrices = book.Prices();
+    
+    for(int i = 0; i < bookPrices.size(); i++)
+    {
+        cout << "Contract: " << i << " => Price: " << bookPrices[i] << " => Delta: " << book.Greeks(i).delta << endl;
+    }
+    
+    cout << endl << "---------- Taylor repricing ---------" << endl;
+    
+    
+    // small ticks come from the delta-gamma-vega expansion, a large one is priced exactly
+    TaylorRepricer taylor(1.0e-3, 0.05);
+    size_t contract = taylor.Add(cod1);
+    
+    vector<double> tickSpot = { 60.1, 60.3, 59.8, 65.0 };
+    
+    for(int i = 0; i < tickSpot.size(); i++)
+    {
+        double approximate = taylor.Reprice(contract, tickSpot[i], cod1.sig);
+        
+        OptionData exactData = cod1;
+        exactData.S = tickSpot[i];
+        
+        cout << "Given stock price: " << tickSpot[i] << " => Taylor price: " << approximate << " => Exact price: "
+             << EuropeanOption(exactData).Greeks().price << " => Error estimate: " << taylor.ErrorEstimate(contract) << endl;
+    }
+    
+    RepriceStatistics repriced = taylor.Statistics();
+    
+    cout << "Approximate: " << repriced.approximate << " => Exact: " << repriced.exact << endl;
+    
+    // a month later the book is re-anchored; rolling past the expiry is rejected
+    taylor.Rebase(1.0 / 12.0);
+    cout << "One month on: " << taylor.Reprice(contract, cod1.S, cod1.sig) << endl;
+    
+    try
+    {
+        taylor.Rebase(0.25);
+    }
+    catch (const invalid_argument& e)
+    {
+        cout << "Rebase by 0.25: " << e.what() << endl;
+    }
+    
+    
     
     return 0;
     
@@ -0,0 +1,186 @@
+// ChebyshevProxy.cpp
+//
+// Tensor product Chebyshev proxy of a pricer of two variables.
+//
+// 2026-10-19 kick-off
+// 2026-10-19 threads through RunParallel()
+// 2026-10-19 column sums zero-initialised
+//
+
+#include "ChebyshevProxy.hpp"
+#include "UtilitiesDJD/ExceptionClasses/DatasimException.hpp"
+#include "UtilitiesDJD/BitsAndPieces/ParallelTasks.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <limits>
+#include <string>
+
+namespace
+{
+	const double Pi = 3.14159265358979323846;
+
+	// pricer(xs[i], ys[j]) at [i * ys.size() + j]. Every call is a task of its own,
+	// as a pricer call costs far more than taking the next index. The first
+	// exception thrown by the pricer stops the workers and is rethrown here.
+	void sampleGrid(const ChebyshevProxy::Pricer& pricer, const std::vector<double>& xs,
+					const std::vector<double>& ys, double* out, unsigned nThreads)
+	{
+		RunParallel(xs.size() * ys.size(), nThreads, [&](ParallelTasks& tasks)
+		{
+			for (std::size_t p; tasks.Next(p); ) out[p] = pricer(xs[p / ys.size()], ys[p % ys.size()]);
+		});
+	}
+
+	// Chebyshev points of the first kind, cos(pi (k + 1/2) / n), mapped onto r
+	std::vector<double> chebyshevNodes(const Range<double>& r, long n)
+	{
+		std::vector<double> x(n);
+		double mid = 0.5 * (r.low() + r.high()), half = 0.5 * r.spread();
+
+		for (long k = 0; k < n; ++k) x[k] = mid + half * std::cos(Pi * (k + 0.5) / double(n));
+
+		return x;
+	}
+}
+
+
+ChebyshevProxy::ChebyshevProxy(const Pricer& pricer, const Range<double>& xRange, const Range<double>& yRange,
+								long nX, long nY, unsigned nThreads)
+	: rx(xRange), ry(yRange), nx(nX), ny(nY)
+{
+	if (nx < 2 || ny < 2 || nx > MaxNodes || ny > MaxNodes || !(xRange.spread() > 0.0) || !(yRange.spread() > 0.0))
+	{
+		throw DatasimException("Need 2 <= nodes <= " + std::to_string(MaxNodes) + " and non-empty ranges",
+								"ChebyshevProxy", std::to_string(nx) + " x " + std::to_string(ny) + " nodes");
+	}
+
+	auto t0 = std::chrono::steady_clock::now();
+
+	sx = 2.0 / xRange.spread(); tx = -(xRange.low() + xRange.high()) / xRange.spread();
+	sy = 2.0 / yRange.spread(); ty = -(yRange.low() + yRange.high()) / yRange.spread();
+
+	std::vector<double> f(nx * ny);
+	sampleGrid(pricer, chebyshevNodes(xRange, nx), chebyshevNodes(yRange, ny), f.data(), nThreads);
+
+	// c_ij = (2 / nx)(2 / ny) sum_kl f_kl cos(i theta_k) cos(j phi_l), halved for i = 0 and j = 0;
+	// one direction at a time
+	std::vector<double> g(nx * ny, 0.0);
+	for (long i = 0; i < nx; ++i)
+	{
+		double w = ((i == 0) ? 1.0 : 2.0) / double(nx);
+		for (long k = 0; k < nx; ++k)
+		{
+			double ck = w * std::cos(Pi * i * (k + 0.5) / double(nx));
+			for (long l = 0; l < ny; ++l) g[i * ny + l] += ck * f[k * ny + l];
+		}
+	}
+
+	std::vector<double> cosY(ny * ny);
+	for (long j = 0; j < ny; ++j)
+	{
+		double w = ((j == 0) ? 1.0 : 2.0) / double(ny);
+		for (long l = 0; l < ny; ++l) cosY[j * ny + l] = w * std::cos(Pi * j * (l + 0.5) / double(ny));
+	}
+
+	c.assign(nx * ny, 0.0);
+	for (long i = 0; i < nx; ++i)
+	{
+		for (long j = 0; j < ny; ++j)
+		{
+			double sum = 0.0;
+			for (long l = 0; l < ny; ++l) sum += cosY[j * ny + l] * g[i * ny + l];
+			c[i * ny + j] = sum;
+		}
+	}
+
+	buildTime = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+}
+
+
+double ChebyshevProxy::operator () (double x, double y) const
+{ // Columns first: a_j = sum_i c_ij T_i(u) are independent sums, so the multiply-adds
+  // overlap instead of waiting on one running total; then sum_j a_j T_j(v)
+
+	double u = sx * x + tx, v = sy * y + ty;
+
+	double a[MaxNodes] = {};		// The compiler cannot see that ny >= 2
+	for (long j = 0; j < ny; ++j) a[j] = c[j] + u * c[ny + j];
+
+	double Tprev = 1.0, Tu = u;
+	for (long i = 2; i < nx; ++i)
+	{
+		double Tnext = 2.0 * u * Tu - Tprev;	// T_(i+1) = 2 u T_i - T_(i-1)
+		Tprev = Tu; Tu = Tnext;
+
+		const double* row = &c[i * ny];
+		for (long j = 0; j < ny; ++j) a[j] += Tu * row[j];
+	}
+
+	double result = a[0] + v * a[1];
+	Tprev = 1.0; double Tv = v;
+	for (long j = 2; j < ny; ++j)
+	{
+		double Tnext = 2.0 * v * Tv - Tprev;
+		Tprev = Tv; Tv = Tnext;
+
+		result += Tv * a[j];
+	}
+
+	return result;
+}
+
+
+ProxyError ChebyshevProxy::Validate(const Pricer& pricer, long mx, long my, unsigned nThreads) const
+{
+	if (mx < 2 || my < 2)
+	{
+		throw DatasimException("Need at least 2 x 2 validation points", "ChebyshevProxy::Validate",
+								std::to_string(mx) + " x " + std::to_string(my));
+	}
+
+	auto t0 = std::chrono::steady_clock::now();
+
+	std::vector<double> xs = rx.mesh(mx - 1), ys = ry.mesh(my - 1);
+	std::vector<double> f(xs.size() * ys.size());
+	sampleGrid(pricer, xs, ys, f.data(), nThreads);
+
+	ProxyError result;
+	result.maxError = -1.0;
+	result.points = long(f.size());
+
+	double sumSquares = 0.0;
+	for (std::size_t i = 0; i < xs.size(); ++i)
+	{
+		for (std::size_t j = 0; j < ys.size(); ++j)
+		{
+			double e = std::fabs((*this)(xs[i], ys[j]) - f[i * ys.size() + j]);
+			if (std::isnan(e)) e = std::numeric_limits<double>::infinity();	// A NaN counts as the worst
+
+			sumSquares += e * e;
+
+			if (e > result.maxError)
+			{
+				result.maxError = e;
+				result.x = xs[i];
+				result.y = ys[j];
+			}
+		}
+	}
+
+	result.rmsError = std::sqrt(sumSquares / double(f.size()));
+	result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+
+	return result;
+}
+
+
+double ChebyshevProxy::TailEstimate() const
+{
+	double tail = 0.0;
+
+	for (long i = 0; i < nx; ++i) tail = std::max(tail, std::fabs(c[i * ny + ny - 1]));
+	for (long j = 0; j < ny; ++j) tail = std::max(tail, std::fabs(c[(nx - 1) * ny + j]));
+
+	return tail;
+}
@@ -0,0 +1,82 @@
+// ChebyshevProxy.hpp
+//
+// Fast proxy of an expensive pricer of two variables, for example a lattice or
+// FDM price as a function of (S, sig) or (S, T). The pricer is sampled once
+// at the nx x ny Chebyshev points of a box and replaced by the interpolating
+// polynomial
+//
+//		p(x, y) = sum_ij c_ij T_i(u(x)) T_j(v(y))
+//
+// where u and v map the box onto [-1, 1] x [-1, 1]. The coefficients come from
+// the samples by a discrete cosine transform in each direction. For prices that
+// are smooth in the box the error falls geometrically with nx and ny. An
+// evaluation is nx + ny recurrence steps and nx ny multiply-adds.
+//
+// The samples are independent, so they are shared out to threads; the pricer
+// must then be safe to call concurrently (use nThreads = 1 if it is not).
+//
+// Validate() compares the proxy with the pricer on a uniform grid and reports
+// the largest error found. This certifies the grid, not the points between
+// them; TailEstimate() (the size of the highest coefficients) shows whether
+// more nodes are needed.
+//
+// 2026-10-19 kick-off
+//
+
+#ifndef ChebyshevProxy_hpp
+#define ChebyshevProxy_hpp
+
+#include "UtilitiesDJD/Geometry/Range.cpp"
+#include <functional>
+#include <vector>
+
+// Result of ChebyshevProxy::Validate()
+struct ProxyError
+{
+	double maxError;	// Largest |proxy - pricer| on the grid
+	double x, y;		// Where it occurs
+	double rmsError;
+	long points;		// Size of the grid
+	double seconds;		// Wall clock time, mostly pricer calls
+};
+
+class ChebyshevProxy
+{
+public:
+	typedef std::function<double (double x, double y)> Pricer;
+
+	static const long MaxNodes = 128;	// Per direction
+
+private:
+	Range<double> rx, ry;
+	long nx, ny;
+	std::vector<double> c;		// c_ij at [i * ny + j]
+	double sx, tx, sy, ty;		// u = sx x + tx, v = sy y + ty
+	double buildTime;
+
+public:
+	// Samples pricer at nx x ny Chebyshev points of xRange x yRange;
+	// nThreads == 0 uses all cores
+	ChebyshevProxy(const Pricer& pricer, const Range<double>& xRange, const Range<double>& yRange,
+					long nx, long ny, unsigned nThreads = 0);
+
+	// Proxy value; inside the box only, outside it the polynomial extrapolates
+	double operator () (double x, double y) const;
+
+	bool contains(double x, double y) const { return rx.contains(x) && ry.contains(y); }
+
+	// Error against pricer on the mx x my uniform grid of the box (end points included)
+	ProxyError Validate(const Pricer& pricer, long mx, long my, unsigned nThreads = 0) const;
+
+	// Largest |c_ij| in the last row and column of the coefficients
+	double TailEstimate() const;
+
+	long Nx() const { return nx; }
+	long Ny() const { return ny; }
+	const std::vector<double>& Coefficients() const { return c; }
+
+	// Wall clock time of the sampling and transform
+	double BuildSeconds() const { return buildTime; }
+};
+
+#endif
@@ -0,0 +1,92 @@
+// ParallelTasks.hpp
+//
+// Independent tasks 0 .. n-1 shared out to worker threads. Each worker
+// takes the next task until all are done, so long and short tasks balance
+// over the threads. A worker is a function
+//
+//		void worker(ParallelTasks& tasks)
+//		{
+//			// Buffers of this thread
+//			for (std::size_t i; tasks.Next(i); ) { ... task i ... }
+//		}
+//
+// and runs once on every thread, the calling thread included, so per thread
+// buffers are set up once and not per task. The first exception thrown by a
+// worker stops the others and is rethrown by RunParallel().
+//
+// 2026-10-19 kick-off
+//
+
+#ifndef ParallelTasks_hpp
+#define ParallelTasks_hpp
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <exception>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+class ParallelTasks
+{
+private:
+	std::size_t count;
+	std::atomic<std::size_t> next;
+	std::atomic<bool> failed;
+
+	std::exception_ptr error;
+	std::mutex errorLock;
+
+	template <class Worker> friend void RunParallel(std::size_t tasks, unsigned nThreads, const Worker& worker);
+
+	template <class Worker> void Run(const Worker& worker)
+	{
+		try
+		{
+			worker(*this);
+		}
+		catch (...)
+		{
+			std::lock_guard<std::mutex> guard(errorLock);
+			if (!error) error = std::current_exception();
+			failed = true;
+		}
+	}
+
+public:
+	explicit ParallelTasks(std::size_t tasks) : count(tasks), next(0), failed(false) {}
+
+	// Takes the next task; false when all are taken or a worker has failed
+	bool Next(std::size_t& task)
+	{
+		if (failed) return false;
+
+		task = next++;
+		return task < count;
+	}
+
+	std::size_t size() const { return count; }
+};
+
+
+// Runs worker on min(nThreads, tasks) threads (nThreads == 0 uses all cores)
+template <class Worker> void RunParallel(std::size_t tasks, unsigned nThreads, const Worker& worker)
+{
+	if (nThreads == 0) nThreads = std::max(1u, std::thread::hardware_concurrency());
+	nThreads = unsigned(std::min<std::size_t>(nThreads, std::max<std::size_t>(tasks, 1)));
+
+	ParallelTasks queue(tasks);
+
+	std::vector<std::thread> threads;
+	for (unsigned t = 1; t < nThreads; ++t)
+	{
+		threads.push_back(std::thread([&queue, &worker]() { queue.Run(worker); }));
+	}
+	queue.Run(worker);
+	for (std::size_t t = 0; t < threads.size(); ++t) threads[t].join();
+
+	if (queue.error) std::rethrow_exception(queue.error);
+}
+
+#endif
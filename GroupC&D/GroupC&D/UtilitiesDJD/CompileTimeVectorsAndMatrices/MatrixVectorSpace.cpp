@@ -9,6 +9,8 @@
 // 2007-6-1 DD Testing and beta code review
 // 2007-8-10 DD new Transpose() const; and M1 * M2
 // 2008-8-4 DD test, debug
+// 2026-10-19 constexpr, aligned rows, matrix * vector with register kernels;
+//				Transpose() returns NC x NR
 //
 // (C) Datasim Component Technology 1999-2009
 
@@ -20,7 +22,7 @@
 
 // Constructors & destructor
 template <typename V,int NR,int NC>
-	MatrixVectorSpace<V,NR,NC>::MatrixVectorSpace()
+	constexpr MatrixVectorSpace<V,NR,NC>::MatrixVectorSpace(): mat()
 { // Default constructor
 
 		V tmp(0.0);	// Assumption
@@ -36,7 +38,7 @@ template <typename V,int NR,int NC>
 }
 
 template <typename V,int NR,int NC>
-	MatrixVectorSpace<V,NR,NC>::MatrixVectorSpace(const V& value)
+	constexpr MatrixVectorSpace<V,NR,NC>::MatrixVectorSpace(const V& value): mat()
 { // Default constructor
 
 		
@@ -51,64 +53,42 @@ template <typename V,int NR,int NC>
 }
 
 template <typename V,int NR,int NC>
-	MatrixVectorSpace<V,NR,NC>::MatrixVectorSpace(const MatrixVectorSpace<V, NR, NC>& source)
-{ // Constructor with  Matrix
-
-	for (int i = 0; i < NR; i++)
-	{
-		for (int j = 0; j < NC; j++)
-		{
-			mat[i][j] = source.mat[i][j];
-		}
-	}
-		
-}
-
-
-template <typename V,int NR,int NC>
-	MatrixVectorSpace<V,NR,NC>::~MatrixVectorSpace()
-{ // Destructor
-
-
-}
-
-template <typename V,int NR,int NC>
-	int MatrixVectorSpace<V,NR,NC>::MinRowIndex() const
+	constexpr int MatrixVectorSpace<V,NR,NC>::MinRowIndex() const
 { // Return the minimum row index
 
 		return 1;
 }
 
 template <typename V,int NR,int NC>
-	int MatrixVectorSpace<V,NR,NC>::MaxRowIndex() const
+	constexpr int MatrixVectorSpace<V,NR,NC>::MaxRowIndex() const
 { // Return the maximum row index
 
 		return NR;
 }
 
 template <typename V,int NR,int NC>
-	int MatrixVectorSpace<V,NR,NC>::MinColumnIndex() const
+	constexpr int MatrixVectorSpace<V,NR,NC>::MinColumnIndex() const
 { // Return the minimum column index
 
 		return 1;
 }
 
 template <typename V,int NR,int NC>
-	int MatrixVectorSpace<V,NR,NC>::MaxColumnIndex() const
+	constexpr int MatrixVectorSpace<V,NR,NC>::MaxColumnIndex() const
 { // Return the maximum column index
 
 		return NC;
 }
 
 template <typename V,int NR,int NC>
-	int MatrixVectorSpace<V,NR,NC>::Rows() const
+	constexpr int MatrixVectorSpace<V,NR,NC>::Rows() const
 { // The number of rows
 
 		return NR;
 }
 
 template <typename V,int NR,int NC>
-	int MatrixVectorSpace<V,NR,NC>::Columns() const
+	constexpr int MatrixVectorSpace<V,NR,NC>::Columns() const
 { // The number of columns
 	
 		return NC;
@@ -118,7 +98,7 @@ template <typename V,int NR,int NC>
 	
 // Operators
 template <typename V,int NR,int NC> 
-	const V& MatrixVectorSpace<V,NR,NC>::operator () (int row, int column) const
+	constexpr const V& MatrixVectorSpace<V,NR,NC>::operator () (int row, int column) const
 { // Get the element at position
 
 
@@ -127,7 +107,7 @@ template <typename V,int NR,int NC>
 }
 	
 template <typename V,int NR,int NC>
-	V& MatrixVectorSpace<V,NR,NC>::operator () (int row, int column)
+	constexpr V& MatrixVectorSpace<V,NR,NC>::operator () (int row, int column)
 { // Get the element at position
 
 		return mat[row-1][column-1];
@@ -135,7 +115,7 @@ template <typename V,int NR,int NC>
 }
 
 template <typename V,int NR,int NC>
-	MatrixVectorSpace<V, NR, NC> MatrixVectorSpace<V,NR,NC>::operator + (const MatrixVectorSpace<V, NR, NC>& source)
+	constexpr MatrixVectorSpace<V, NR, NC> MatrixVectorSpace<V,NR,NC>::operator + (const MatrixVectorSpace<V, NR, NC>& source) const
 {
 
 		MatrixVectorSpace<V, NR, NC> result;
@@ -154,7 +134,7 @@ template <typename V,int NR,int NC>
 
 
 template <typename V,int NR,int NC>
-	MatrixVectorSpace<V, NR, NC> MatrixVectorSpace<V,NR,NC>::operator - (const MatrixVectorSpace<V, NR, NC>& source)
+	constexpr MatrixVectorSpace<V, NR, NC> MatrixVectorSpace<V,NR,NC>::operator - (const MatrixVectorSpace<V, NR, NC>& source) const
 	{
 
 		MatrixVectorSpace<V, NR, NC> result;
@@ -193,27 +173,19 @@ template <typename V,int NR,int NC>
 }
 */
 template <typename V,int NR,int NC>
-	VectorSpace<V, NR> MatrixVectorSpace<V,NR,NC>::operator *(const VectorSpace<V,NC>& vector)
+	constexpr VectorSpace<V, NR> MatrixVectorSpace<V,NR,NC>::operator *(const VectorSpace<V,NC>& vector) const
 { // Multiply matrix by vector
 
 		VectorSpace<V, NR> result;
 
-		for (int j = 1; j <= NR; j++)
-		{
-			result[j] = V(0.0);
-
-			for (int k = 0; k < NC; k++)
-			{
-				result[j] += (*this).mat[j-1][k] * vector[k+1];
-			}
-		}
+		VectorSpaceKernels<V, NC>::template MatVec<NR>(result.Data(), mat, vector.Data());
 
 		return result;
 }
 
 // Other linear algebra routines
 template <typename V,int NR,int NC>
-	MatrixVectorSpace<V, NR, NC> MatrixVectorSpace<V,NR,NC>::Transpose() const
+	constexpr MatrixVectorSpace<V, NC, NR> MatrixVectorSpace<V,NR,NC>::Transpose() const
 { // Rows and Columns interchange
 
 		const int NR2 = NC;
@@ -232,24 +204,6 @@ template <typename V,int NR,int NC>
 		return result;
 }
 
-template <typename V,int NR,int NC>
-	MatrixVectorSpace<V, NR, NC>& MatrixVectorSpace<V,NR,NC>::operator = (const MatrixVectorSpace<V, NR, NC>& source)
-{
-
-		if (this == &source)
-			return *this;
-
-		for (int i = 0; i < NR; i++)
-		{
-			for (int j = 0; j < NC; j++)
-			{
-				mat[i][j] = source.mat[i][j];
-			}
-		}
-
-		return *this;
-}
-
 
 
 #endif
\ No newline at end of file
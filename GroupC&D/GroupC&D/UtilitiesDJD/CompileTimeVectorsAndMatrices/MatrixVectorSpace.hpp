@@ -3,6 +3,10 @@
 // Numeric Matrix class.
 // This is a COMPILE-TIME Matrix class for numerical data. 
 //
+// Like VectorSpace a literal type with constexpr member functions. The rows are
+// aligned as VectorSpace<V, NC>; matrix * vector uses the inner product kernel
+// of VectorSpaceKernels.hpp for each row.
+//
 // (C) Datasim Component Technology 1999-2007
 
 #ifndef MatrixVectorSpace_hpp
@@ -17,34 +21,32 @@ template <typename V,int NR,int NC>
 //private:
 public:
 
-		V mat[NR][NC];
+		alignas(VectorSpaceAlignment<V, NC>::value) V mat[NR][NC];
 public:
 	// Constructors & destructor
-	MatrixVectorSpace();
-	MatrixVectorSpace(const V& value);
-	MatrixVectorSpace(const MatrixVectorSpace<V, NR, NC>& source);
-
-	virtual ~MatrixVectorSpace();
+	constexpr MatrixVectorSpace();
+	constexpr MatrixVectorSpace(const V& value);
+	constexpr MatrixVectorSpace(const MatrixVectorSpace<V, NR, NC>& source) = default;
 
 
 	// Selectors
-	inline int MinRowIndex() const;
-	inline int MaxRowIndex() const;
-	inline int MinColumnIndex() const;
-	inline int MaxColumnIndex() const;
-	inline int Rows() const;
-	inline int Columns() const;
+	constexpr int MinRowIndex() const;
+	constexpr int MaxRowIndex() const;
+	constexpr int MinColumnIndex() const;
+	constexpr int MaxColumnIndex() const;
+	constexpr int Rows() const;
+	constexpr int Columns() const;
 		
 	// Operators; indexing starts at 1
-	inline const V& operator () (int row, int column) const;
-	inline V& operator () (int row, int column);
+	constexpr const V& operator () (int row, int column) const;
+	constexpr V& operator () (int row, int column);
 	
-	MatrixVectorSpace<V, NR, NC> operator + (const MatrixVectorSpace<V, NR, NC>& source);
-	MatrixVectorSpace<V, NR, NC> operator - (const MatrixVectorSpace<V, NR, NC>& source);
+	constexpr MatrixVectorSpace<V, NR, NC> operator + (const MatrixVectorSpace<V, NR, NC>& source) const;
+	constexpr MatrixVectorSpace<V, NR, NC> operator - (const MatrixVectorSpace<V, NR, NC>& source) const;
 
 	// Template member function
 	template <int NC2>
-		MatrixVectorSpace<V, NR, NC2> operator * (const MatrixVectorSpace<V, NC, NC2>& source)
+		constexpr MatrixVectorSpace<V, NR, NC2> operator * (const MatrixVectorSpace<V, NC, NC2>& source) const
 	{
 		MatrixVectorSpace<V, NR, NC2> result;
 
@@ -63,12 +65,12 @@ public:
 		return result;
 	}
 
-	VectorSpace<V, NR> operator *(const VectorSpace<V,NC>& vector);
+	constexpr VectorSpace<V, NR> operator *(const VectorSpace<V,NC>& vector) const;
  
-	MatrixVectorSpace<V, NR, NC>& operator = (const MatrixVectorSpace<V, NR, NC>& source);
+	constexpr MatrixVectorSpace<V, NR, NC>& operator = (const MatrixVectorSpace<V, NR, NC>& source) = default;
 
 	// Other linear algebra routines
-	MatrixVectorSpace<V, NR, NC> Transpose() const;	// Rows and Columns interchange
+	constexpr MatrixVectorSpace<V, NC, NR> Transpose() const;	// Rows and Columns interchange
 
 };
 
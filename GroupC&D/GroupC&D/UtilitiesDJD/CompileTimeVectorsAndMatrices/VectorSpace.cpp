@@ -9,6 +9,7 @@
 //  DD 2007-3-10 vector * scalar and scalar * vector
 //  DD 2007-5-31 beta testing phase == debug + code review
 //	DD 2008-8-4 More tests 
+//	2026-10-19 constexpr, aligned, register kernels; Norm() uses |x|
 //
 // (C) Datasim Education BV  1995-2009
 
@@ -20,7 +21,7 @@
 
 // Default constructor
 template<typename Type, int N>
-	VectorSpace<Type, N>::VectorSpace()
+	constexpr VectorSpace<Type, N>::VectorSpace(): arr()
 {
 	// Create an VectorSpace with default value
 	for (int i=0; i<N; ++i) 
@@ -30,7 +31,7 @@ template<typename Type, int N>
 
 
 template<typename Type, int N>
-	VectorSpace<Type, N>::VectorSpace(const Type& value)
+	constexpr VectorSpace<Type, N>::VectorSpace(const Type& value): arr()
 {
 	// Create an VectorSpace with default n
 	for (int i=0; i<N; ++i) 
@@ -39,34 +40,20 @@ template<typename Type, int N>
 }
 
 
-// Copy constructor
 template<typename Type, int N>
-	VectorSpace<Type, N>::VectorSpace(const VectorSpace<Type, N>& source)
-{
-	// Deep copy source
-	for (int i=0; i < N; ++i) arr[i]=source.arr[i];
-}
-
-// Destructor
-template<typename Type, int N>
-	VectorSpace<Type, N>::~VectorSpace()
-{
-}
-
-template<typename Type, int N>
-	int VectorSpace<Type, N>::Size() const
+	constexpr int VectorSpace<Type, N>::Size() const
 {
 	return N;
 }
 
 template<typename Type, int N>
-	int VectorSpace<Type, N>::MinIndex() const
+	constexpr int VectorSpace<Type, N>::MinIndex() const
 {
 	return 1;
 }
 
 template<typename Type, int N>
-	int VectorSpace<Type, N>::MaxIndex() const
+	constexpr int VectorSpace<Type, N>::MaxIndex() const
 {
 	return N;
 }
@@ -74,37 +61,21 @@ template<typename Type, int N>
 
 
 template<typename Type, int N>
-	Type VectorSpace<Type, N>::innerProduct (const VectorSpace<Type, N>& source) const
+	constexpr Type VectorSpace<Type, N>::innerProduct (const VectorSpace<Type, N>& source) const
 { // Dot product
 
-	Type result = arr[0] * source.arr[0];
-
-	for (int i=1; i<N; ++i)
-	{
-		
-		result += (arr[i] * source.arr[i]);
-
-	}
-
-	return result;
+	return VectorSpaceKernels<Type, N>::Dot(arr, source.arr);
 }
 
 template<typename Type, int N>
-	Type VectorSpace<Type, N>::Norm() const
-{ // The l Infinity norm
-
-	Type result = arr[0];
-
-	for (int i=1; i<N; ++i)
-	{
-		result = max(arr[i], result);
-	}
+	constexpr Type VectorSpace<Type, N>::Norm() const
+{ // The l Infinity norm, max |x[i]|
 
-	return result;
+	return VectorSpaceKernels<Type, N>::MaxAbs(arr);
 }
 
 template<typename Type, int N>
-	VectorSpace<Type, N> VectorSpace<Type, N>::operator - () const
+	constexpr VectorSpace<Type, N> VectorSpace<Type, N>::operator - () const
 { // The negation of a vector
 
 	// Vectors should have same size
@@ -121,7 +92,7 @@ template<typename Type, int N>
 
 // Addition
 template<typename Type, int N>
-	VectorSpace<Type, N> VectorSpace<Type, N>::operator + (const VectorSpace<Type, N>& v2) const
+	constexpr VectorSpace<Type, N> VectorSpace<Type, N>::operator + (const VectorSpace<Type, N>& v2) const
 {
 
 	// Vectors should have same size
@@ -137,7 +108,7 @@ template<typename Type, int N>
 }
 
 template<typename Type, int N>
-	VectorSpace<Type, N> VectorSpace<Type, N>::operator + (const Type& offset) const
+	constexpr VectorSpace<Type, N> VectorSpace<Type, N>::operator + (const Type& offset) const
 {
 
 	// Vectors should have same size
@@ -153,7 +124,7 @@ template<typename Type, int N>
 }
 
 template<typename Type, int N>
-	VectorSpace<Type, N> VectorSpace<Type, N>::operator - (const Type& offset) const
+	constexpr VectorSpace<Type, N> VectorSpace<Type, N>::operator - (const Type& offset) const
 {
 
 	// Vectors should have same size
@@ -169,7 +140,7 @@ template<typename Type, int N>
 }
 
 template<typename Type, int N>
-VectorSpace<Type, N> VectorSpace<Type, N>::operator -(const VectorSpace<Type, N>& v2) const
+	constexpr VectorSpace<Type, N> VectorSpace<Type, N>::operator -(const VectorSpace<Type, N>& v2) const
 {
 
 	// Vectors should have same size
@@ -186,7 +157,7 @@ VectorSpace<Type, N> VectorSpace<Type, N>::operator -(const VectorSpace<Type, N>
 
 
 // Premultiplication by a field value
-template <typename Type, int N, typename F> VectorSpace<Type, N> 
+template <typename Type, int N, typename F> constexpr VectorSpace<Type, N> 
 				operator * (const F& scalar, const VectorSpace<Type, N>& v)
 {
 
@@ -206,33 +177,20 @@ template <typename Type, int N, typename F> VectorSpace<Type, N>
 
 // Index operator for non const VectorSpaces
 template<typename Type, int N>
-	Type& VectorSpace<Type, N>::operator[](int index)
+	constexpr Type& VectorSpace<Type, N>::operator[](int index)
 {
 	return arr[index-1];
 }
 
 template<typename Type, int N>
-	const Type& VectorSpace<Type, N>::operator[](int index) const
+	constexpr const Type& VectorSpace<Type, N>::operator[](int index) const
 {
 	return arr[index-1];
 }
 
-// Assignment operator
-template<typename Type, int N>
-	VectorSpace<Type, N>& VectorSpace<Type, N>::operator = (const VectorSpace<Type, N>& source)
-{
-	// Exit if same object
-	if (this==&source) return *this;
-
-	// Deep copy source
-	for (int i=0; i<N;++i) arr[i]=source.arr[i];
-
-	return *this;
-}
-
 // Other selector functions
 template<typename Type, int N>
-Type VectorSpace<Type, N>::componentProduct() const
+	constexpr Type VectorSpace<Type, N>::componentProduct() const
 { // The product of all components
 
 	Type result = arr[0];
@@ -13,56 +13,65 @@
 // This class is useful for 'tiny' arrays and matrices that fit in stack
 // memory.
 //
+// The class is a literal type: all member functions are constexpr, copies are
+// plain memory copies and there is no virtual destructor. The elements are
+// aligned to their size rounded up to a power of two (at most 64 bytes), and
+// innerProduct() and Norm() use the register kernels in VectorSpaceKernels.hpp.
+//
 // (C) Datasim Education BV  1995-2009
 //
 
 #ifndef VectorSpace_HPP
 #define VectorSpace_HPP
 
+#include "UtilitiesDJD/CompileTimeVectorsAndMatrices/VectorSpaceKernels.hpp"
+
 
 template<typename Type, int N> class VectorSpace
 {
 private:
 	
-	Type arr[N];
+	alignas(VectorSpaceAlignment<Type, N>::value) Type arr[N];
 
 public:
 	// Constructors & destructor
-	VectorSpace();
-	VectorSpace(const Type& value);	// All elements get this value
-	VectorSpace(const VectorSpace<Type, N>& source);
-	virtual ~VectorSpace();
+	constexpr VectorSpace();
+	constexpr VectorSpace(const Type& value);	// All elements get this value
+	constexpr VectorSpace(const VectorSpace<Type, N>& source) = default;
 
 	// Selectors
-	int Size() const;
-	int MinIndex() const;
-	int MaxIndex() const;
+	constexpr int Size() const;
+	constexpr int MinIndex() const;
+	constexpr int MaxIndex() const;
+
+	constexpr Type* Data() { return arr; }				// The N elements
+	constexpr const Type* Data() const { return arr; }
 
 	// Some properties
-	Type innerProduct (const VectorSpace<Type, N>& p2) const; // Inner product
-	Type Norm() const; // The l Infinity norm
-	Type componentProduct() const;				// The product of all components
+	constexpr Type innerProduct (const VectorSpace<Type, N>& p2) const; // Inner product
+	constexpr Type Norm() const; // The l Infinity norm
+	constexpr Type componentProduct() const;				// The product of all components
 
 	// Numeric operations
-	VectorSpace<Type, N> operator - () const; // The negative of a vector
+	constexpr VectorSpace<Type, N> operator - () const; // The negative of a vector
 
-	VectorSpace<Type, N> operator + (const VectorSpace<Type, N>& v2) const;
-	VectorSpace<Type, N> operator - (const VectorSpace<Type, N>& v2) const;
+	constexpr VectorSpace<Type, N> operator + (const VectorSpace<Type, N>& v2) const;
+	constexpr VectorSpace<Type, N> operator - (const VectorSpace<Type, N>& v2) const;
 
-	VectorSpace<Type, N> operator + (const Type& offset) const; // Add offset to each coord
-	VectorSpace<Type, N> operator - (const Type& offset) const; // Sub offset to each coord
-
-	// ** Template member functions ** Premultiplication by a field value
-	template <typename F> VectorSpace<Type, N> 
-				friend operator * (const F& scalar, const VectorSpace<Type, N>& pt);
+	constexpr VectorSpace<Type, N> operator + (const Type& offset) const; // Add offset to each coord
+	constexpr VectorSpace<Type, N> operator - (const Type& offset) const; // Sub offset to each coord
 
 	// Operators
-	Type& operator[](int index);				// Index operator for non const VectorSpaces
-	const Type& operator[](int index) const;	// Index operator for const VectorSpaces
+	constexpr Type& operator[](int index);				// Index operator for non const VectorSpaces
+	constexpr const Type& operator[](int index) const;	// Index operator for const VectorSpaces
 
-	VectorSpace<Type, N>& operator = (const VectorSpace<Type, N>& source);
+	constexpr VectorSpace<Type, N>& operator = (const VectorSpace<Type, N>& source) = default;
 
 	
 };
 
+// Premultiplication by a field value
+template <typename Type, int N, typename F> constexpr VectorSpace<Type, N> 
+				operator * (const F& scalar, const VectorSpace<Type, N>& pt);
+
 #endif // VectorSpace_hpp
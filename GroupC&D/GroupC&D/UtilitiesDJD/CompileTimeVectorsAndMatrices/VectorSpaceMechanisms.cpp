@@ -6,6 +6,7 @@
 // 2007-6-1 DD Testing and beta code review
 // 2007-6-8 DD new void functions for converting bwteem 
 // 2007-10-15 DD TripleSum (saxpy)
+// 2026-10-19 TripleSum with register kernels; typename and convertToDynamicVectorII fixes
 //
 // (C) Datasim Education BV 2007-2008
 //
@@ -36,7 +37,7 @@ void print(const list<VectorSpace<V,N> >& l)
 	cout << endl << "Size of list is: " << l.size() << endl;
 
 	// Create list iterator
-	list<VectorSpace<V,N> >::const_iterator i;
+	typename list<VectorSpace<V,N> >::const_iterator i;
 	
 	cout << endl;
 
@@ -95,7 +96,7 @@ template <typename V, int N>
 {
 	for (long i = output.MinIndex(); i <= output.MaxIndex(); ++i)
 	{
-		output[i] = myArray[i];
+		output[i] = input[i];
 	}
 
 }
@@ -133,7 +134,7 @@ template <typename V>
 
 	// Build map by iterating from start of vector to end
 	// Init part
-	list<Vector<V, long>* >::const_iterator i = group.begin();
+	typename list<Vector<V, long>* >::const_iterator i = group.begin();
 	long startIndex = (**i).MinIndex();
 	long size = (**i).Size();
 	double dsize = 1.0 / group.size();
@@ -242,10 +243,7 @@ template <typename V, int N>
 
 		// Precondition: all vectors have same size
 
-	for (int j = D.MinIndex(); j <= D.MaxIndex(); ++j)
-	{
-		D[j] = A[j] + (b*B[j]) + (c*C[j]);
-	}
+	VectorSpaceKernels<V, N>::TripleSum(D.Data(), A.Data(), B.Data(), C.Data(), b, c);
 
 }
 #endif
\ No newline at end of file
@@ -0,0 +1,68 @@
+// MeshView.cpp
+//
+// Meshes computed on demand.
+//
+// 2026-10-19 kick-off
+//
+
+#ifndef MeshView_CPP
+#define MeshView_CPP
+
+#include "UtilitiesDJD/Geometry/MeshView.hpp"
+#include <cmath>
+
+// Maps
+template <class Type>
+Type UniformMap<Type>::operator () (const Type& low, const Type& high, double u) const
+{
+	return low + (high - low) * u;
+}
+
+template <class Type>
+Type LogMap<Type>::operator () (const Type& low, const Type& high, double u) const
+{
+	return low * std::exp(u * std::log(high / low));
+}
+
+template <class Type>
+SinhMap<Type>::SinhMap(const Type& centre, double concentrationIntensity)
+	: c(centre), intensity(concentrationIntensity)
+{
+}
+
+template <class Type>
+Type SinhMap<Type>::operator () (const Type& low, const Type& high, double u) const
+{
+	Type alpha = intensity * (high - low);
+	double c1 = std::asinh((low - c) / alpha);
+	double c2 = std::asinh((high - c) / alpha);
+
+	return c + alpha * std::sinh(c1 * (1.0 - u) + c2 * u);
+}
+
+
+// MeshView
+template <class Type, class Map>
+MeshView<Type, Map>::MeshView(const Type& low, const Type& high, long nSteps, const Map& map)
+	: lo(low), hi(high), n(nSteps), m_map(map)
+{
+}
+
+template <class Type, class Map>
+Type MeshView<Type, Map>::operator [] (long i) const
+{ // Point i; no accumulation, and the end points are exact
+
+	if (i <= 0) return lo;
+	if (i >= n) return hi;
+
+	return m_map(lo, hi, double(i) / double(n));
+}
+
+template <class Type, class Map>
+std::vector<Type> MeshView<Type, Map>::toVector() const
+{
+	return std::vector<Type>(begin(), end());
+}
+
+
+#endif	// MeshView_CPP
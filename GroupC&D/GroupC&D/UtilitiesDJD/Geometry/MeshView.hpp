@@ -0,0 +1,124 @@
+// MeshView.hpp
+//
+// A mesh of nSteps + 1 points in [low, high] that stores no points. Point i is
+// computed when it is asked for, so a sweep over millions of points needs no
+// memory for the mesh and point i does not depend on how the mesh was walked.
+// The end points are exactly low and high.
+//
+// The spacing is given by a map policy: point i is map(low, high, i / nSteps).
+//
+//	UniformMap		equal steps
+//	LogMap			equal steps in log(x); low > 0, e.g. a sweep over the underlying
+//	SinhMap			points clustered around a centre, e.g. the strike
+//
+// The view has random access iterators, so it can be given to the standard
+// algorithms and to any sweep written for a std::vector.
+//
+// 2026-10-19 kick-off
+//
+
+#ifndef MeshView_HPP
+#define MeshView_HPP
+
+#include <cstddef>
+#include <iterator>
+#include <vector>
+
+// Maps
+template <class Type> struct UniformMap
+{
+	Type operator () (const Type& low, const Type& high, double u) const;
+};
+
+template <class Type> struct LogMap
+{
+	Type operator () (const Type& low, const Type& high, double u) const;
+};
+
+template <class Type> class SinhMap
+{ // x(u) = centre + alpha sinh(c1 (1 - u) + c2 u), alpha = intensity * (high - low).
+  // A smaller intensity gives a stronger concentration around the centre.
+private:
+	Type c;
+	double intensity;
+
+public:
+	SinhMap(const Type& centre, double concentrationIntensity = 0.1);
+
+	Type operator () (const Type& low, const Type& high, double u) const;
+};
+
+
+template <class Type, class Map = UniformMap<Type> > class MeshView
+{
+private:
+	Type lo;
+	Type hi;
+	long n;			// Number of steps
+	Map m_map;
+
+public:
+	class const_iterator
+	{
+	private:
+		const MeshView<Type, Map>* m_mesh;
+		long m_index;
+
+	public:
+		typedef std::random_access_iterator_tag iterator_category;
+		typedef Type value_type;
+		typedef std::ptrdiff_t difference_type;
+		typedef const Type* pointer;
+		typedef Type reference;		// Points are values, not stored objects
+
+		const_iterator(): m_mesh(0), m_index(0) {}
+		const_iterator(const MeshView<Type, Map>* mesh, long index): m_mesh(mesh), m_index(index) {}
+
+		Type operator * () const { return (*m_mesh)[m_index]; }
+		Type operator [] (difference_type k) const { return (*m_mesh)[m_index + k]; }
+
+		const_iterator& operator ++ () { ++m_index; return *this; }
+		const_iterator& operator -- () { --m_index; return *this; }
+		const_iterator operator ++ (int) { const_iterator tmp(*this); ++m_index; return tmp; }
+		const_iterator operator -- (int) { const_iterator tmp(*this); --m_index; return tmp; }
+
+		const_iterator& operator += (difference_type k) { m_index += long(k); return *this; }
+		const_iterator& operator -= (difference_type k) { m_index -= long(k); return *this; }
+		const_iterator operator + (difference_type k) const { return const_iterator(m_mesh, m_index + long(k)); }
+		const_iterator operator - (difference_type k) const { return const_iterator(m_mesh, m_index - long(k)); }
+		friend const_iterator operator + (difference_type k, const const_iterator& it) { return it + k; }
+		difference_type operator - (const const_iterator& other) const { return m_index - other.m_index; }
+
+		bool operator == (const const_iterator& other) const { return m_index == other.m_index; }
+		bool operator != (const const_iterator& other) const { return m_index != other.m_index; }
+		bool operator < (const const_iterator& other) const { return m_index < other.m_index; }
+		bool operator > (const const_iterator& other) const { return m_index > other.m_index; }
+		bool operator <= (const const_iterator& other) const { return m_index <= other.m_index; }
+		bool operator >= (const const_iterator& other) const { return m_index >= other.m_index; }
+	};
+
+	typedef const_iterator iterator;
+	typedef Type value_type;
+	typedef std::size_t size_type;
+
+	// Constructors
+	MeshView(const Type& low, const Type& high, long nSteps, const Map& map = Map());
+
+	// Accessing functions
+	Type low() const { return lo; }
+	Type high() const { return hi; }
+	long steps() const { return n; }
+	std::size_t size() const { return std::size_t(n + 1); }
+
+	Type operator [] (long i) const;			// Point i, 0 <= i <= steps()
+	Type front() const { return lo; }
+	Type back() const { return hi; }
+
+	const_iterator begin() const { return const_iterator(this, 0); }
+	const_iterator end() const { return const_iterator(this, n + 1); }
+
+	std::vector<Type> toVector() const;			// All points, when they must be stored
+};
+
+
+#endif	// MeshView_HPP
@@ -16,6 +16,7 @@
 // AM 25-03-1996 Changed subset, intersects modified to use contains
 // 2001-1-30 DD length() function
 // 20023-1-21 DD Lite version for book
+// 2026-10-19 mesh() no longer accumulates h, so the last point is high(); meshView()
 //
 // (C) Datasim Education BV 1994-2006
 
@@ -151,19 +152,14 @@ template <class Type>
 std::vector<Type> Range<Type>::mesh(long nSteps) const
 { // Create a discrete mesh
 
-	Type h = (hi - lo) / Type (nSteps);
-
-	std::vector<Type>result(nSteps + 1);
-
-	Type val = lo;
+	return meshView(nSteps).toVector();
+}
 
-	for (long i = 0; i < nSteps + 1; i++)	
-	{
-		result[i] = val;
-		val += h;
-	}
+template <class Type>
+MeshView<Type> Range<Type>::meshView(long nSteps) const
+{ // Point i is computed when asked for
 
-	return result;
+	return MeshView<Type>(lo, hi, nSteps);
 }
 
 
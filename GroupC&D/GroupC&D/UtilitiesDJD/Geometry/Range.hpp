@@ -4,12 +4,17 @@
 // needed in many applications, for example candlestick charts in 
 // financial futures.
 //
+// 2026-10-19 mesh() without accumulated rounding; meshView() computes points on demand
+//
 // (C) Datasim Education BV 2003-2006
 
 
 #ifndef Range_HPP
 #define Range_HPP
 
+#include "UtilitiesDJD/Geometry/MeshView.cpp"
+#include <vector>
+
 template <class Type> class Range
 {
 
@@ -44,6 +49,7 @@ public:
 	
 	// Utility functions
 	std::vector<Type> mesh(long nSteps) const;	// Create a discrete mesh
+	MeshView<Type> meshView(long nSteps) const;	// The same points, none stored
 
 	// Operator overloading
 	Range<Type>& operator = (const Range<Type>& ran2);
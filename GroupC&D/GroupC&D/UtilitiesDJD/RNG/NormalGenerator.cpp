@@ -15,6 +15,7 @@
 //  2009-5-16 DD generate fixed arrays of normal variates
 //	2009-6-29 DD Boost Normal generator
 //  2012-1-17 DD minimal Boost
+//	2026-10-19 getNormals() and seeded BoostNormal
 //
 // (C) Datasim Education BV 2008-20012
 //
@@ -23,6 +24,11 @@
 #include <cmath>
 
 
+void NormalGenerator::getNormals(double* out, std::size_t n) const
+{
+	for (std::size_t i = 0; i < n; ++i) out[i] = getNormal();
+}
+
 
 BoostNormal::BoostNormal() : NormalGenerator ()
 {
@@ -34,12 +40,29 @@ BoostNormal::BoostNormal() : NormalGenerator ()
 }
 
 
+BoostNormal::BoostNormal(unsigned int seed) : NormalGenerator ()
+{ // Independent streams for different seeds, e.g. one per block of paths
+
+	rng = boost::lagged_fibonacci607(seed);
+	nor = boost::normal_distribution<>(0,1);
+	myRandom = new boost::variate_generator<boost::lagged_fibonacci607&, boost::normal_distribution<> >
+			(rng, nor);
+}
+
+
 // Implement (variant) hook function
 double BoostNormal::getNormal() const
 {
 	return (*myRandom)();
 }
 
+void BoostNormal::getNormals(double* out, std::size_t n) const
+{ // No virtual call per variate
+
+	boost::variate_generator<boost::lagged_fibonacci607&, boost::normal_distribution<> >& gen = *myRandom;
+	for (std::size_t i = 0; i < n; ++i) out[i] = gen();
+}
+
 
 BoostNormal::~BoostNormal() 
 {
@@ -11,6 +11,7 @@
 // functions. In another chapter we use policy classes and templates.
 //
 // 2012-17 DD restrict to Boost
+// 2026-10-19 bulk generation and seeded BoostNormal
 //
 // (C) Datasim Education BV 2008-2012
 //
@@ -23,14 +24,19 @@
 #include <boost/random/mersenne_twister.hpp>
 #include <boost/random/normal_distribution.hpp>
 #include <boost/random/variate_generator.hpp>
+#include <cstddef>
 
 class NormalGenerator
 {
 
 public:
 
-	// Empty at the moment
 	virtual double getNormal() const = 0;
+
+	// n variates in one call; the default calls getNormal() n times
+	virtual void getNormals(double* out, std::size_t n) const;
+
+	virtual ~NormalGenerator() {}
 };
 
 
@@ -46,9 +52,11 @@ private:
 
 public:
 	BoostNormal();	// NB no uniform parameters
+	BoostNormal(unsigned int seed);
 
 	// Implement (variant) hook function
 	double getNormal() const;
+	void getNormals(double* out, std::size_t n) const;
 
 	~BoostNormal();
 };
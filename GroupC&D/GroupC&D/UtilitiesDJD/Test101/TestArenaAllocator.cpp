@@ -0,0 +1,118 @@
+// TestArenaAllocator.cpp
+//
+// Vectors with arena storage: scoped release, reuse of the last allocation,
+// mixing with ordinary vectors in expressions, and the cost of many short-lived
+// vectors on several threads compared with the default allocator.
+//
+// 2026-10-19 kick-off
+//
+
+#include "UtilitiesDJD/VectorsAndMatrices/Vector.cpp"
+#include "UtilitiesDJD/VectorsAndMatrices/ArenaAllocator.cpp"
+#include <chrono>
+#include <iostream>
+#include <thread>
+using namespace std;
+
+typedef Vector<double, long> HeapVector;
+typedef Vector<double, long, FullArray<double, ArenaAllocator<double> > > ScratchVector;
+
+// Backward induction with a new vector per level, the pattern of the lattice
+// and FDM loops
+template <class Vec> double induction(long n)
+{
+	Vec current(n + 1, 0);
+	for (long j = current.MinIndex(); j <= current.MaxIndex(); ++j) current[j] = double(j);
+
+	for (long level = n - 1; level >= 0; --level)
+	{
+		Vec next(level + 1, 0);
+		for (long j = 0; j <= level; ++j)
+		{
+			next[j] = 0.5 * (current[j] + current[j + 1]);
+		}
+
+		current = std::move(next);
+	}
+
+	return current[0];
+}
+
+template <class Vec> double pricing(int requests, long n)
+{
+	double sum = 0.0;
+	for (int r = 0; r < requests; ++r)
+	{
+		ArenaScope scope;					// Unused for HeapVector
+		sum += induction<Vec>(n);
+	}
+
+	return sum;
+}
+
+template <class Vec> double timeThreads(unsigned threads, int requests, long n, double& result)
+{
+	std::vector<double> sums(threads);
+	auto t0 = std::chrono::steady_clock::now();
+
+	std::vector<std::thread> workers;
+	for (unsigned t = 0; t < threads; ++t)
+	{
+		workers.push_back(std::thread([&sums, t, requests, n]() { sums[t] = pricing<Vec>(requests, n); }));
+	}
+	for (unsigned t = 0; t < threads; ++t) workers[t].join();
+
+	result = sums[0];
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+}
+
+int main()
+{
+	MonotonicArena& arena = ThreadArena();
+	std::size_t start = arena.Used();
+
+	{
+		ArenaScope scope;
+		ScratchVector u(1000, 1, 1.0), v(1000, 1, 2.0);
+		HeapVector w(1000, 1, 3.0);
+
+		ScratchVector r = u * 2.0 + v - w;		// Mixed storage in one expression
+		cout << "r[1] = " << r[1] << " (1), used " << arena.Used() - start << " bytes" << endl;
+	}
+	cout << "After scope, used " << arena.Used() - start << " bytes (0)" << endl;
+
+	{
+		ArenaScope scope;
+		for (int k = 0; k < 100000; ++k)
+		{
+			ScratchVector tmp(256, 1, double(k));	// Last allocation is given back
+		}
+		cout << "Loop of 100000 vectors, used " << arena.Used() - start << " bytes" << endl;
+	}
+
+	// Copies outside the scope are independent of the arena
+	HeapVector kept;
+	{
+		ArenaScope scope;
+		ScratchVector s(5, 1, 4.0);
+		kept = s * 1.0;
+	}
+	cout << "Kept: " << kept[5] << " (4)" << endl << endl;
+
+	// Many pricing requests on several threads
+	unsigned threads = std::thread::hardware_concurrency();
+	if (threads < 4) threads = 4;
+	const int requests = 400;
+	const long n = 500;
+
+	double r1, r2;
+	double heap = timeThreads<HeapVector>(threads, requests, n, r1);
+	double scratch = timeThreads<ScratchVector>(threads, requests, n, r2);
+
+	cout << threads << " threads, " << requests << " requests of " << n << " levels each" << endl;
+	cout << "Same result: " << (r1 == r2) << endl;
+	cout << "std::allocator: " << heap << "s" << endl;
+	cout << "ArenaAllocator: " << scratch << "s" << endl;
+
+	return 0;
+}
@@ -2,11 +2,62 @@
 //
 // Testing matrix multiplication
 //
+// 2026-10-19 blocked kernels against the naive loop
+// 2026-10-19 products of incompatible sizes
+//
 // (C) Datasim Education BV 2006-2012
 
 #include "UtilitiesDJD/VectorsAndMatrices/NumericMatrix.cpp"
 #include "UtilitiesDJD/VectorsAndMatrices/MatrixMechanisms.cpp"
 #include <complex> // Use STL built-in complex numbers class
+#include <chrono>
+#include <cmath>
+
+// Reference product with the naive triple loop
+template <class M> M naiveProduct(const M& a, const M& b)
+{
+	M c(a.Rows(), b.Columns());
+	for (long i = 1; i <= a.Rows(); ++i)
+	{
+		for (long j = 1; j <= b.Columns(); ++j)
+		{
+			double sum = 0.0;
+			for (long k = 1; k <= a.Columns(); ++k) sum += a(i, k) * b(k, j);
+			c(i, j) = sum;
+		}
+	}
+
+	return c;
+}
+
+template <class M> void fill(M& m, double seed)
+{
+	for (long i = 1; i <= m.Rows(); ++i)
+		for (long j = 1; j <= m.Columns(); ++j) m(i, j) = std::sin(seed * double(i) + double(j));
+}
+
+template <class M> void timeProduct(long n, const char* name)
+{
+	M a(n, n + 3), b(n + 3, n - 5), c(n, n - 5);
+	fill(a, 0.3); fill(b, 0.7);
+
+	auto t0 = std::chrono::steady_clock::now();
+	M ref = naiveProduct(a, b);
+	auto t1 = std::chrono::steady_clock::now();
+	a.Multiply(b, c);
+	auto t2 = std::chrono::steady_clock::now();
+
+	double diff = 0.0;
+	for (long i = 1; i <= c.Rows(); ++i)
+		for (long j = 1; j <= c.Columns(); ++j) diff = std::max(diff, std::abs(c(i, j) - ref(i, j)));
+
+	double flops = 2.0 * double(n) * double(n + 3) * double(n - 5);
+	double naive = std::chrono::duration<double>(t1 - t0).count();
+	double blocked = std::chrono::duration<double>(t2 - t1).count();
+
+	cout << name << " n = " << n << ": naive " << flops / naive * 1.0e-9 << " GFLOP/s, blocked "
+		<< flops / blocked * 1.0e-9 << " GFLOP/s, max difference " << diff << endl;
+}
 
 int main()
 {
@@ -24,5 +75,54 @@ int main()
 
 	print(m3C);
 
+	// Small product with known answer
+	NumericMatrix<double, long> a(2, 3), b(3, 2);
+	for (long i = 1; i <= 2; ++i)
+		for (long j = 1; j <= 3; ++j) { a(i, j) = double(i + j); b(j, i) = double(i * j); }
+	print(a * b);
+
+	Vector<double, long> v(3, 1, 1.0);
+	print(a * v);
+
+	// Blocked kernel against the naive loop, both storage structures
+	timeProduct<NumericMatrix<double, long> >(300, "FullMatrix");
+	timeProduct<NumericMatrix<double, long, RowMajorMatrix<double> > >(300, "RowMajorMatrix");
+	timeProduct<NumericMatrix<double, long, RowMajorMatrix<double> > >(800, "RowMajorMatrix");
+
+	// Matrix times vector into an existing result
+	NumericMatrix<double, long, RowMajorMatrix<double> > big(1000, 1000);
+	fill(big, 0.1);
+	Vector<double, long> x(1000, 1, 1.0), y(1000, 1);
+	big.Multiply(x, y);
+
+	double err = 0.0;
+	for (long i = 1; i <= 1000; ++i)
+	{
+		double sum = 0.0;
+		for (long j = 1; j <= 1000; ++j) sum += big(i, j);
+		err = std::max(err, std::abs(sum - y[i]));
+	}
+	cout << "Matrix-vector max difference " << err << endl;
+
+	// Sizes that do not match are rejected, not truncated
+	try
+	{
+		Vector<double, long> w(2, 1, 1.0);
+		print(a * w);
+	}
+	catch (DatasimException& e)
+	{
+		e.print();
+	}
+
+	try
+	{
+		print(a * a);
+	}
+	catch (DatasimException& e)
+	{
+		e.print();
+	}
+
 	return 0;
 }
\ No newline at end of file
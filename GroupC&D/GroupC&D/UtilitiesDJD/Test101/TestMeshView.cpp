@@ -0,0 +1,51 @@
+// TestMeshView.cpp
+//
+// Meshes computed on demand: exact end points, agreement with the stored mesh
+// of Range, the non-uniform maps, and a sweep over 10^8 points with no storage.
+//
+// 2026-10-19 kick-off
+//
+
+#include "UtilitiesDJD/Geometry/Range.cpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <numeric>
+
+int main()
+{
+	// The old mesh added h to the previous point; 0.1 * 10 steps ended at 0.9999999999999999
+	Range<double> r(0.0, 1.0);
+	std::vector<double> x = r.mesh(10);
+	std::cout << "Range::mesh(10): " << x.size() << " points, last point == 1: " << (x.back() == 1.0) << std::endl;
+
+	MeshView<double> view = r.meshView(10);
+	std::cout << "Same points in the view: " << std::equal(view.begin(), view.end(), x.begin()) << std::endl;
+
+	// Spot sweep equally spaced in log S, and a mesh clustered around the strike
+	MeshView<double, LogMap<double> > logS(50.0, 200.0, 4);
+	std::cout << "Log mesh:";
+	for (double s : logS) std::cout << " " << s;
+	std::cout << std::endl;
+
+	MeshView<double, SinhMap<double> > clustered(0.0, 200.0, 10, SinhMap<double>(100.0, 0.05));
+	std::cout << "Clustered at 100:";
+	for (long i = 0; i <= clustered.steps(); ++i) std::cout << " " << clustered[i];
+	std::cout << std::endl;
+	std::cout << "Increasing: " << std::is_sorted(clustered.begin(), clustered.end())
+		<< ", binary search for 100: index " << (std::lower_bound(clustered.begin(), clustered.end(), 100.0) - clustered.begin()) << std::endl;
+
+	// A sweep that would otherwise need 800 MB of mesh
+	const long N = 100000000;
+	MeshView<double> big(0.0, 1.0, N);
+
+	auto t0 = std::chrono::steady_clock::now();
+	double sum = std::accumulate(big.begin(), big.end(), 0.0);
+	double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+
+	std::cout << "Sum over " << big.size() << " points: " << sum << " (expected " << 0.5 * (N + 1) << "), "
+		<< seconds << " s, last point " << big[N] << std::endl;
+
+	return 0;
+}
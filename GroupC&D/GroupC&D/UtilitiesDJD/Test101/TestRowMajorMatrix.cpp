@@ -0,0 +1,90 @@
+// TestRowMajorMatrix.cpp
+//
+// Testing NumericMatrix with contiguous row-major storage against the
+// default FullMatrix storage.
+//
+// 2026-10-19 kick-off
+//
+
+#include "UtilitiesDJD/VectorsAndMatrices/NumericMatrix.cpp"
+#include "UtilitiesDJD/VectorsAndMatrices/MatrixMechanisms.cpp"
+#include <chrono>
+#include <cmath>
+
+typedef NumericMatrix<double, long> NestedStorage;
+typedef NumericMatrix<double, long, RowMajorMatrix<double> > ContiguousStorage;
+
+template <class M> void fill(M& m)
+{
+	for (long i = m.MinRowIndex(); i <= m.MaxRowIndex(); ++i)
+	{
+		for (long j = m.MinColumnIndex(); j <= m.MaxColumnIndex(); ++j)
+		{
+			m(i, j) = 1.0 / double((i - m.MinRowIndex()) + (j - m.MinColumnIndex()) + 1);
+		}
+	}
+}
+
+template <class M> double sumAll(const M& m)
+{
+	double sum = 0.0;
+	for (long i = m.MinRowIndex(); i <= m.MaxRowIndex(); ++i)
+	{
+		for (long j = m.MinColumnIndex(); j <= m.MaxColumnIndex(); ++j)
+		{
+			sum += m(i, j);
+		}
+	}
+
+	return sum;
+}
+
+int main()
+{
+	// Small example with a non-default start index
+	ContiguousStorage m(3, 5, 0, 0);
+	fill(m);
+	print(m);
+
+	RowMajorMatrix<double> raw(3, 5);
+	cout << "Columns: " << raw.Columns() << ", leading dimension: " << raw.Stride() << endl;
+	cout << "Row 2 aligned: " << (reinterpret_cast<std::size_t>(raw[2].Data()) % 64 == 0) << endl << endl;
+
+	// Both storage schemes must give the same answers
+	const long n = 500;
+	NestedStorage a(n, n);
+	ContiguousStorage b(n, n);
+	fill(a); fill(b);
+
+	Vector<double, long> v(n, 1);
+	for (long j = v.MinIndex(); j <= v.MaxIndex(); ++j) v[j] = double(j);
+
+	Vector<double, long> av = a * v;
+	Vector<double, long> bv = b * v;
+
+	NestedStorage at = a.Transpose() + a;
+	ContiguousStorage bt = b.Transpose() + b;
+
+	double diff = 0.0;
+	for (long i = 1; i <= n; ++i)
+	{
+		diff = std::max(diff, std::abs(av[i] - bv[i]));
+		for (long j = 1; j <= n; ++j) diff = std::max(diff, std::abs(at(i, j) - bt(i, j)));
+	}
+	cout << "Max difference between storage schemes: " << diff << endl;
+
+	// Element access timing
+	const int repeats = 20;
+	double s1 = 0.0, s2 = 0.0;
+
+	auto t0 = std::chrono::steady_clock::now();
+	for (int k = 0; k < repeats; ++k) s1 += sumAll(a);
+	auto t1 = std::chrono::steady_clock::now();
+	for (int k = 0; k < repeats; ++k) s2 += sumAll(b);
+	auto t2 = std::chrono::steady_clock::now();
+
+	cout << "Sum " << s1 << " FullMatrix: " << std::chrono::duration<double>(t1 - t0).count() << "s" << endl;
+	cout << "Sum " << s2 << " RowMajorMatrix: " << std::chrono::duration<double>(t2 - t1).count() << "s" << endl;
+
+	return 0;
+}
@@ -0,0 +1,147 @@
+// TestSparseMatrix.cpp
+//
+// Banded (tridiagonal, pentadiagonal) and CSR storage in NumericMatrix: the
+// products and triangular solves against dense storage, a banded LU solve, a
+// 2D 5-point operator in CSR, and implicit Euler for the heat equation on a
+// mesh too large for a dense matrix.
+//
+// 2026-10-19 kick-off
+//
+
+#include "UtilitiesDJD/VectorsAndMatrices/NumericMatrix.cpp"
+#include <chrono>
+#include <cmath>
+
+typedef Vector<double, int> DVector;
+
+template <class M> double maxDifference(const M& m, const NumericMatrix<double, int>& dense)
+{
+	double err = 0.0;
+	for (int i = 1; i <= dense.Rows(); ++i)
+	{
+		for (int j = 1; j <= dense.Columns(); ++j) err = std::max(err, std::fabs(m(i, j) - dense(i, j)));
+	}
+
+	return err;
+}
+
+double maxDifference(const DVector& a, const DVector& b)
+{
+	double err = 0.0;
+	for (int i = a.MinIndex(); i <= a.MaxIndex(); ++i) err = std::max(err, std::fabs(a[i] - b[i]));
+
+	return err;
+}
+
+// Same entries in a band matrix and a dense one
+template <class S> void compare(const char* name, int n, int kl, int ku)
+{
+	NumericMatrix<double, int, S> m(n, n);
+	NumericMatrix<double, int> dense(n, n);
+
+	for (int i = 1; i <= n; ++i)
+	{
+		for (int j = std::max(1, i - kl); j <= std::min(n, i + ku); ++j)
+		{
+			double value = (i == j) ? 4.0 + i : 1.0 / (i + 2.0 * j);
+			m(i, j) = value;
+			dense(i, j) = value;
+		}
+	}
+
+	DVector x(n, 1);
+	for (int i = 1; i <= n; ++i) x[i] = std::sin(double(i));
+
+	cout << name << ": elements " << maxDifference(m, dense)
+		<< ", A x " << maxDifference(m * x, dense * x)
+		<< ", lower solve " << maxDifference(m.SolveLower(x), dense.SolveLower(x))
+		<< ", upper solve " << maxDifference(m.SolveUpper(x, true), dense.SolveUpper(x, true)) << endl;
+}
+
+int main()
+{
+	// 1. Against dense storage
+	compare<TridiagonalMatrix<double> >("Tridiagonal", 50, 1, 1);
+	compare<PentadiagonalMatrix<double> >("Pentadiagonal", 50, 2, 2);
+	compare<BandedMatrix<double, 1, 3> >("Band (1, 3)", 50, 1, 3);
+	compare<CSRMatrix<double> >("CSR", 50, 2, 3);
+
+	// Writes outside the band are discarded
+	NumericMatrix<double, int, TridiagonalMatrix<double> > t(4, 4);
+	t(1, 4) = 5.0;
+	cout << "Outside the band: " << t(1, 4) << endl;
+
+	// 2. Banded LU solve of A x = b
+	const int n = 200;
+	NumericMatrix<double, int, PentadiagonalMatrix<double> > p(n, n);
+	for (int i = 1; i <= n; ++i)
+	{
+		p(i, i) = 6.0;
+		if (i > 1) p(i, i - 1) = -2.0;
+		if (i < n) p(i, i + 1) = -1.5;
+		if (i > 2) p(i, i - 2) = 0.5;
+		if (i < n - 1) p(i, i + 2) = 1.0;
+	}
+
+	DVector exact(n, 1), b(n, 1), x(n, 1);
+	for (int i = 1; i <= n; ++i) exact[i] = std::cos(0.1 * i);
+	b = p * exact;
+	p.Structure().Solve(&b[1], &x[1]);
+	cout << "Pentadiagonal LU solve error: " << maxDifference(x, exact) << endl;
+
+	// 3. 5-point Laplacian on an m x m grid, assembled in row order
+	const int m = 300;
+	const int unknowns = m * m;
+	NumericMatrix<double, int, CSRMatrix<double> > laplace(unknowns, unknowns);
+	for (int r = 0; r < m; ++r)
+	{
+		for (int c = 0; c < m; ++c)
+		{
+			int k = r * m + c + 1;
+			if (r > 0) laplace(k, k - m) = -1.0;
+			if (c > 0) laplace(k, k - 1) = -1.0;
+			laplace(k, k) = 4.0;
+			if (c < m - 1) laplace(k, k + 1) = -1.0;
+			if (r < m - 1) laplace(k, k + m) = -1.0;
+		}
+	}
+
+	DVector ones(unknowns, 1, 1.0), y(unknowns, 1);
+	auto t0 = std::chrono::steady_clock::now();
+	laplace.Multiply(ones, y);
+	double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+
+	double rowSum = 0.0;
+	for (int k = 1; k <= unknowns; ++k) rowSum += y[k];
+	cout << "2D Laplacian " << unknowns << " unknowns, " << laplace.Structure().NonZeros() << " entries"
+		<< ", sum of A 1 = " << rowSum << " (expected " << 4 * m << "), A x in " << seconds << " s" << endl;
+
+	// 4. Implicit Euler for u_t = u_xx on (0, 1), u = 0 at both ends, u(x, 0) = sin(pi x)
+	const int J = 1000000;
+	const int steps = 20;
+	const double h = 1.0 / J, k = 0.01 / steps, lambda = k / (h * h);
+	const double pi = 3.14159265358979323846;
+
+	NumericMatrix<double, int, TridiagonalMatrix<double> > A(J - 1, J - 1);
+	for (int i = 1; i < J; ++i)
+	{
+		A(i, i) = 1.0 + 2.0 * lambda;
+		if (i > 1) A(i, i - 1) = -lambda;
+		if (i < J - 1) A(i, i + 1) = -lambda;
+	}
+
+	std::vector<double> u(J - 1);
+	for (int i = 1; i < J; ++i) u[i - 1] = std::sin(pi * i * h);
+
+	t0 = std::chrono::steady_clock::now();
+	TridiagonalMatrix<double> lu = A.Structure().LUFactors();
+	for (int s = 0; s < steps; ++s) lu.SolveFactored(&u[0], &u[0]);
+	seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+
+	double err = 0.0, decay = std::exp(-pi * pi * 0.01);
+	for (int i = 1; i < J; ++i) err = std::max(err, std::fabs(u[i - 1] - decay * std::sin(pi * i * h)));
+	cout << "Implicit Euler, J = " << J << ", " << steps << " steps: error " << err
+		<< " (time discretisation), " << seconds << " s" << endl;
+
+	return 0;
+}
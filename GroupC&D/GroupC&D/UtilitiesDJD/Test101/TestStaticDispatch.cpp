@@ -0,0 +1,94 @@
+// TestStaticDispatch.cpp
+//
+// Element access throughput of Vector (statically dispatched FullArray) against
+// the same storage used through the virtual ArrayStructure interface, which is
+// how every access went before, and against a raw pointer.
+//
+// 2026-10-19 kick-off
+//
+
+#include "UtilitiesDJD/VectorsAndMatrices/Vector.cpp"
+#include <chrono>
+#include <iostream>
+using namespace std;
+
+typedef Vector<double, int> DVector;
+typedef ArrayStructureAdapter<FullArray<double> > VirtualArray;
+
+// y += a * x
+void axpy(double a, const DVector& x, DVector& y)
+{
+	for (int j = y.MinIndex(); j <= y.MaxIndex(); ++j) y[j] += a * x[j];
+}
+
+void axpy(double a, const ArrayStructure<double>& x, ArrayStructure<double>& y)
+{
+	for (size_t j = y.MinIndex(); j <= y.MaxIndex(); ++j) y[j] += a * x[j];
+}
+
+void axpy(double a, const double* x, double* y, int n)
+{
+	for (int j = 0; j < n; ++j) y[j] += a * x[j];
+}
+
+// One step of backward induction, the inner loop of the binomial method
+void induction(const DVector& next, DVector& current)
+{
+	for (int j = current.MinIndex(); j <= current.MaxIndex(); ++j)
+	{
+		current[j] = 0.5 * (next[j] + next[j + 1]);
+	}
+}
+
+void induction(const ArrayStructure<double>& next, ArrayStructure<double>& current)
+{
+	for (size_t j = current.MinIndex(); j <= current.MaxIndex(); ++j)
+	{
+		current[j] = 0.5 * (next[j] + next[j + 1]);
+	}
+}
+
+template <class Body> double nsPerElement(long elements, const Body& body)
+{
+	auto t0 = std::chrono::steady_clock::now();
+	body();
+	return std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count() / double(elements) * 1.0e9;
+}
+
+int main()
+{
+	const int n = 1000;
+	const int repeats = 100000;
+	const long elements = long(n) * repeats;
+
+	DVector x(n, 1, 1.0), y(n, 1, 0.0), z(n + 1, 1, 1.0);
+	VirtualArray vx(n), vy(n), vz(n + 1);
+	std::vector<double> px(n, 1.0), py(n, 0.0);
+	for (size_t j = 1; j <= vx.Size(); ++j) { vx[j] = 1.0; vy[j] = 0.0; }
+	for (size_t j = 1; j <= vz.Size(); ++j) vz[j] = 1.0;
+
+	// Through references to the base, as a caller in another translation unit sees them
+	ArrayStructure<double>& bx = vx;
+	ArrayStructure<double>& by = vy;
+	ArrayStructure<double>& bz = vz;
+
+	double a = 1.0e-9;
+	double tVector = nsPerElement(elements, [&]() { for (int r = 0; r < repeats; ++r) axpy(a, x, y); });
+	double tVirtual = nsPerElement(elements, [&]() { for (int r = 0; r < repeats; ++r) axpy(a, bx, by); });
+	double tPointer = nsPerElement(elements, [&]() { for (int r = 0; r < repeats; ++r) axpy(a, &px[0], &py[0], n); });
+
+	cout << "axpy, ns per element" << endl;
+	cout << "Vector:         " << tVector << endl;
+	cout << "ArrayStructure: " << tVirtual << endl;
+	cout << "Pointer:        " << tPointer << endl;
+	cout << "Same result: " << (y[n] == by[n] && y[n] == py[n - 1]) << endl << endl;
+
+	tVector = nsPerElement(elements, [&]() { for (int r = 0; r < repeats; ++r) { induction(z, y); z[1] = y[2]; } });
+	tVirtual = nsPerElement(elements, [&]() { for (int r = 0; r < repeats; ++r) { induction(bz, by); bz[1] = by[2]; } });
+
+	cout << "Backward induction, ns per node" << endl;
+	cout << "Vector:         " << tVector << endl;
+	cout << "ArrayStructure: " << tVirtual << endl;
+
+	return 0;
+}
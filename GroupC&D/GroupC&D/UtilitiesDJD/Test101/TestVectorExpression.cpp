@@ -0,0 +1,75 @@
+// TestVectorExpression.cpp
+//
+// Testing the expression templates for Vector and NumericMatrix. A compound
+// expression is evaluated in one loop on assignment, without temporary vectors.
+//
+// 2026-10-19 kick-off
+// 2026-10-19 reuse of a temporary operand
+//
+
+#include "UtilitiesDJD/VectorsAndMatrices/NumericMatrix.cpp"
+#include "UtilitiesDJD/VectorsAndMatrices/MatrixMechanisms.cpp"
+#include <chrono>
+#include <cmath>
+
+int main()
+{
+	const long n = 1000000;
+	const double a = 0.5, b = 2.0;
+
+	Vector<double, long> v1(n, 1), v2(n, 1), r(n, 1);
+	for (long i = v1.MinIndex(); i <= v1.MaxIndex(); ++i)
+	{
+		v1[i] = std::sin(double(i));
+		v2[i] = std::cos(double(i));
+	}
+
+	// Fused expression against a hand-written loop
+	const int repeats = 50;
+
+	auto t0 = std::chrono::steady_clock::now();
+	for (int k = 0; k < repeats; ++k) r = a * v1 + v2 * b - v1 / 4.0;
+	auto t1 = std::chrono::steady_clock::now();
+
+	Vector<double, long> check(n, 1);
+	for (int k = 0; k < repeats; ++k)
+	{
+		for (long i = check.MinIndex(); i <= check.MaxIndex(); ++i) check[i] = a * v1[i] + v2[i] * b - v1[i] / 4.0;
+	}
+	auto t2 = std::chrono::steady_clock::now();
+
+	double diff = 0.0;
+	for (long i = r.MinIndex(); i <= r.MaxIndex(); ++i) diff = std::max(diff, std::abs(r[i] - check[i]));
+
+	cout << "Expression: " << std::chrono::duration<double>(t1 - t0).count() << "s, loop: "
+		<< std::chrono::duration<double>(t2 - t1).count() << "s, max difference " << diff << endl;
+
+	// Compound assignment and a new vector from an expression
+	Vector<double, long> w = -v1 + 1.0;
+	w += v1 * v1;
+	w -= 1.0 - v2;
+	cout << "w[1] = " << w[1] << ", expected " << (-v1[1] + 1.0 + v1[1] * v1[1] - (1.0 - v2[1])) << endl;
+
+	// A temporary left operand is reused: no new storage for the result
+	Vector<double, long> t(v1);
+	const double* storage = t.Data();
+	Vector<double, long> u = std::move(t) * 2.0 + v2;
+	cout << "Storage reused: " << (u.Data() == storage) << ", u[1] = " << u[1] << ", expected " << 2.0 * v1[1] + v2[1] << endl;
+
+	// Matrices
+	NumericMatrix<double, long, RowMajorMatrix<double> > m1(2, 3), m2(2, 3);
+	for (long i = 1; i <= 2; ++i)
+	{
+		for (long j = 1; j <= 3; ++j) { m1(i, j) = double(i); m2(i, j) = double(j); }
+	}
+
+	NumericMatrix<double, long, RowMajorMatrix<double> > m3 = m1 + 2.0 * m2 - (-m1) / 2.0;
+	print(m3);
+
+	NumericMatrix<double, long> f1(2, 2);
+	f1(1, 1) = 1.0; f1(2, 2) = 2.0;
+	NumericMatrix<double, long> f2 = f1 - f1 * 3.0;
+	print(f2);
+
+	return 0;
+}
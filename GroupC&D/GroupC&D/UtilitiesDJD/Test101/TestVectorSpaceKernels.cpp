@@ -0,0 +1,128 @@
+// TestVectorSpaceKernels.cpp
+//
+// VectorSpace and MatrixVectorSpace at compile time, the register kernels for
+// N = 2, 3, 4, 8 against the plain loops, and timings of both.
+//
+// 2026-10-19 kick-off
+//
+
+#include "UtilitiesDJD/CompileTimeVectorsAndMatrices/MatrixVectorSpace.cpp"
+#include "UtilitiesDJD/CompileTimeVectorsAndMatrices/VectorSpaceMechanisms.cpp"
+#include <chrono>
+#include <cmath>
+#include <random>
+
+// Evaluated by the compiler
+constexpr VectorSpace<double, 3> Unit(int i)
+{
+	VectorSpace<double, 3> e;
+	e[i] = 1.0;
+	return e;
+}
+
+constexpr MatrixVectorSpace<double, 3, 3> Rotation()
+{
+	MatrixVectorSpace<double, 3, 3> m;
+	m(1, 2) = -1.0; m(2, 1) = 1.0; m(3, 3) = 1.0;
+	return m;
+}
+
+static_assert((Unit(1) + Unit(2)).innerProduct(Unit(2)) == 1.0, "");
+static_assert((Rotation() * Unit(1))[2] == 1.0, "");
+static_assert((-Unit(3) - 2.0).Norm() == 3.0, "");
+static_assert(alignof(VectorSpace<double, 4>) == 32 && alignof(VectorSpace<double, 8>) == 64, "");
+static_assert(std::is_trivially_copyable<VectorSpace<double, 4> >::value, "");
+
+template <int N> VectorSpace<double, N> random(std::mt19937& gen)
+{
+	std::uniform_real_distribution<double> u(-1.0, 1.0);
+
+	VectorSpace<double, N> v;
+	for (int i = v.MinIndex(); i <= v.MaxIndex(); ++i) v[i] = u(gen);
+
+	return v;
+}
+
+template <int N> void check(std::mt19937& gen)
+{
+	typedef VectorSpaceLoops<double, N> Loops;
+
+	double err = 0.0;
+	for (int k = 0; k < 1000; ++k)
+	{
+		VectorSpace<double, N> a = random<N>(gen), b = random<N>(gen), c = random<N>(gen), d, e;
+		MatrixVectorSpace<double, N, N> m;
+		for (int i = 1; i <= N; ++i) for (int j = 1; j <= N; ++j) m(i, j) = a[i] * b[j] + c[j];
+
+		err = std::max(err, std::fabs(a.innerProduct(b) - Loops::Dot(a.Data(), b.Data())));
+		err = std::max(err, std::fabs(a.Norm() - Loops::MaxAbs(a.Data())));
+
+		TripleSum(d, a, b, c, 0.5, -2.0);
+		Loops::TripleSum(e.Data(), a.Data(), b.Data(), c.Data(), 0.5, -2.0);
+		err = std::max(err, (d - e).Norm());
+
+		Loops::template MatVec<N>(e.Data(), m.mat, a.Data());
+		err = std::max(err, (m * a - e).Norm());
+	}
+
+	cout << "N = " << N << ": max difference " << err << endl;
+}
+
+// One Euler step x += mu dt + L dW of N correlated factors on each of many paths
+template <int N, class Step> double timeSteps(const Step& step)
+{
+	const int paths = 4096;
+	const int steps = 1000;
+
+	std::mt19937 gen(42);
+	std::vector<VectorSpace<double, N> > dW(paths + 1);
+	for (int k = 0; k <= paths; ++k) dW[k] = 0.01 * random<N>(gen);
+
+	MatrixVectorSpace<double, N, N> L;
+	for (int i = 1; i <= N; ++i) for (int j = 1; j <= i; ++j) L(i, j) = 0.5 + 0.5 * random<N>(gen)[j];
+	VectorSpace<double, N> mu(0.01);
+	std::vector<VectorSpace<double, N> > x(paths, VectorSpace<double, N>(1.0));
+
+	auto t0 = std::chrono::steady_clock::now();
+	for (int n = 0; n < steps; ++n)
+	{
+		for (int p = 0; p < paths; ++p) step(x[p], mu, L, dW[p + (n & 1)]);
+	}
+	double t = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+
+	cout << "(" << x[0].innerProduct(x[paths - 1]) << ") ";
+	return t / (double(paths) * steps) * 1.0e9;
+}
+
+template <int N> void timing()
+{
+	typedef VectorSpaceLoops<double, N> Loops;
+
+	double kernels = timeSteps<N>([](VectorSpace<double, N>& x, const VectorSpace<double, N>& mu,
+									const MatrixVectorSpace<double, N, N>& L, const VectorSpace<double, N>& dW)
+	{
+		TripleSum(x, x, mu, L * dW, 0.001, 1.0);
+	});
+
+	double loops = timeSteps<N>([](VectorSpace<double, N>& x, const VectorSpace<double, N>& mu,
+									const MatrixVectorSpace<double, N, N>& L, const VectorSpace<double, N>& dW)
+	{
+		VectorSpace<double, N> z;
+		Loops::template MatVec<N>(z.Data(), L.mat, dW.Data());
+		Loops::TripleSum(x.Data(), x.Data(), mu.Data(), z.Data(), 0.001, 1.0);
+	});
+
+	cout << "N = " << N << ": kernels " << kernels << " ns, loops " << loops << " ns per step" << endl;
+}
+
+int main()
+{
+	std::mt19937 gen(1234);
+
+	check<2>(gen); check<3>(gen); check<4>(gen); check<8>(gen); check<5>(gen);
+	cout << endl;
+
+	timing<2>(); timing<3>(); timing<4>(); timing<8>();
+
+	return 0;
+}
@@ -0,0 +1,41 @@
+// AlignedAllocator.hpp
+//
+// Standard allocator returning memory aligned to a given boundary
+// (default a 64 byte cache line). It can be used as the TA argument of
+// FullArray and of the contiguous matrix storage.
+//
+// 2026-10-19 kick-off
+//
+
+#ifndef AlignedAllocator_hpp
+#define AlignedAllocator_hpp
+
+#include <cstddef>
+#include <new>
+
+template <class V, std::size_t Alignment = 64>
+class AlignedAllocator
+{
+public:
+	typedef V value_type;
+
+	template <class U> struct rebind { typedef AlignedAllocator<U, Alignment> other; };
+
+	AlignedAllocator() {}
+	template <class U> AlignedAllocator(const AlignedAllocator<U, Alignment>&) {}
+
+	V* allocate(std::size_t n)
+	{
+		return static_cast<V*>(::operator new(n * sizeof(V), std::align_val_t(Alignment)));
+	}
+
+	void deallocate(V* p, std::size_t)
+	{
+		::operator delete(p, std::align_val_t(Alignment));
+	}
+
+	template <class U> bool operator == (const AlignedAllocator<U, Alignment>&) const { return true; }
+	template <class U> bool operator != (const AlignedAllocator<U, Alignment>&) const { return false; }
+};
+
+#endif	// AlignedAllocator_hpp
@@ -0,0 +1,126 @@
+// ArenaAllocator.cpp
+//
+// Monotonic arena and the per-thread arenas.
+//
+// 2026-10-19 kick-off
+//
+
+#ifndef ArenaAllocator_cpp
+#define ArenaAllocator_cpp
+
+#include "UtilitiesDJD/VectorsAndMatrices/ArenaAllocator.hpp"
+
+#include <cstdint>
+#include <new>
+
+
+inline MonotonicArena::MonotonicArena(std::size_t blockSize)
+	: m_blocks(), m_block(0), m_top(0), m_end(0), m_blockSize(blockSize)
+{ // The first block is allocated here, later ones as needed
+
+	Block first = { static_cast<char*>(::operator new(m_blockSize)), m_blockSize };
+	m_blocks.push_back(first);
+
+	m_top = first.begin;
+	m_end = first.begin + first.size;
+}
+
+inline MonotonicArena::~MonotonicArena()
+{ // Destructor
+
+	for (std::size_t b = 0; b < m_blocks.size(); ++b)
+	{
+		::operator delete(m_blocks[b].begin);
+	}
+}
+
+inline void MonotonicArena::NextBlock(std::size_t bytes, std::size_t alignment)
+{ // Use the next block if it is large enough, otherwise put a new one in front of it
+
+	std::size_t needed = bytes + alignment;
+
+	if (m_block + 1 == m_blocks.size() || m_blocks[m_block + 1].size < needed)
+	{
+		std::size_t size = (needed > m_blockSize) ? needed : m_blockSize;
+		Block block = { static_cast<char*>(::operator new(size)), size };
+		m_blocks.insert(m_blocks.begin() + (m_block + 1), block);
+	}
+
+	++m_block;
+	m_top = m_blocks[m_block].begin;
+	m_end = m_top + m_blocks[m_block].size;
+}
+
+inline void* MonotonicArena::Allocate(std::size_t bytes, std::size_t alignment)
+{ // Bump the pointer
+
+	std::size_t padding = (alignment - reinterpret_cast<std::uintptr_t>(m_top) % alignment) % alignment;
+
+	if (std::size_t(m_end - m_top) < padding + bytes)
+	{
+		NextBlock(bytes, alignment);
+		padding = (alignment - reinterpret_cast<std::uintptr_t>(m_top) % alignment) % alignment;
+	}
+
+	char* p = m_top + padding;
+	m_top = p + bytes;
+
+	return p;
+}
+
+inline void MonotonicArena::Deallocate(void* p, std::size_t bytes)
+{ // Only the last allocation in the current block is given back
+
+	char* q = static_cast<char*>(p);
+
+	if (q + bytes == m_top && q >= m_blocks[m_block].begin)
+	{
+		m_top = q;
+	}
+}
+
+inline MonotonicArena::Mark MonotonicArena::Position() const
+{
+	Mark mark = { m_block, m_top };
+	return mark;
+}
+
+inline void MonotonicArena::Rewind(const Mark& mark)
+{ // O(1); the blocks after the mark stay available
+
+	m_block = mark.block;
+	m_top = mark.top;
+	m_end = m_blocks[m_block].begin + m_blocks[m_block].size;
+}
+
+inline void MonotonicArena::Release()
+{
+	Mark start = { 0, m_blocks[0].begin };
+	Rewind(start);
+}
+
+inline std::size_t MonotonicArena::Capacity() const
+{
+	std::size_t bytes = 0;
+	for (std::size_t b = 0; b < m_blocks.size(); ++b) bytes += m_blocks[b].size;
+
+	return bytes;
+}
+
+inline std::size_t MonotonicArena::Used() const
+{
+	std::size_t bytes = 0;
+	for (std::size_t b = 0; b < m_block; ++b) bytes += m_blocks[b].size;
+
+	return bytes + std::size_t(m_top - m_blocks[m_block].begin);
+}
+
+
+inline MonotonicArena& ThreadArena()
+{ // Created on first use in each thread
+
+	static thread_local MonotonicArena arena;
+	return arena;
+}
+
+#endif	// ArenaAllocator_cpp
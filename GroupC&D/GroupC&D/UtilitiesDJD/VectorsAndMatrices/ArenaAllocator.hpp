@@ -0,0 +1,145 @@
+// ArenaAllocator.hpp
+//
+// Monotonic (bump pointer) memory for short-lived containers.
+//
+// A MonotonicArena hands out memory from large blocks by moving a pointer.
+// Individual deallocations are free; only the most recent allocation is
+// given back (so a loop that creates and destroys one scratch vector per
+// step does not grow the arena). All memory since a given point is released
+// in O(1) by rewinding the arena, and the blocks are kept for the next use.
+//
+// Each thread has its own arena, ThreadArena(), so threads that price in
+// parallel do not contend on the global heap. ArenaAllocator is the TA
+// argument of FullArray (and RowMajorMatrix, FullMatrix) that takes its
+// memory from the arena of the constructing thread:
+//
+//		typedef FullArray<double, ArenaAllocator<double> > ScratchArray;
+//		typedef Vector<double, long, ScratchArray> ScratchVector;
+//
+//		{
+//			ArenaScope scope;			// Marks the arena of this thread
+//			ScratchVector u(n, 1), v(n, 1);
+//			...
+//		}								// All memory since the mark released
+//
+// Containers that use arena memory must be destroyed before the scope in
+// which their memory was allocated ends.
+//
+// 2026-10-19 kick-off
+//
+
+#ifndef ArenaAllocator_hpp
+#define ArenaAllocator_hpp
+
+#include <cstddef>
+#include <vector>
+#include <type_traits>
+
+
+class MonotonicArena
+{
+public:
+	// Position in the arena, see Position() and Rewind()
+	struct Mark
+	{
+		std::size_t block;
+		char* top;
+	};
+
+private:
+	struct Block
+	{
+		char* begin;
+		std::size_t size;
+	};
+
+	std::vector<Block> m_blocks;		// Blocks in order of use; kept after Rewind()
+	std::size_t m_block;				// Current block
+	char* m_top;						// First free byte in the current block
+	char* m_end;						// End of the current block
+	std::size_t m_blockSize;			// Size of a new block
+
+	MonotonicArena(const MonotonicArena&) = delete;
+	MonotonicArena& operator = (const MonotonicArena&) = delete;
+
+	void NextBlock(std::size_t bytes, std::size_t alignment);	// Move to a block with room for bytes
+
+public:
+	// Constructors & destructor
+	explicit MonotonicArena(std::size_t blockSize = 1 << 20);
+	~MonotonicArena();
+
+	// Memory
+	void* Allocate(std::size_t bytes, std::size_t alignment);
+	void Deallocate(void* p, std::size_t bytes);		// Only reclaims the last allocation
+
+	// Release all memory allocated after a mark, or all memory
+	Mark Position() const;
+	void Rewind(const Mark& mark);
+	void Release();
+
+	// Selectors
+	std::size_t Capacity() const;		// Bytes owned by the arena
+	std::size_t Used() const;			// Bytes from the start up to the current position
+};
+
+// The arena of the calling thread
+MonotonicArena& ThreadArena();
+
+
+// Releases everything allocated in an arena during its lifetime
+class ArenaScope
+{
+private:
+	MonotonicArena& m_arena;
+	MonotonicArena::Mark m_mark;
+
+	ArenaScope(const ArenaScope&) = delete;
+	ArenaScope& operator = (const ArenaScope&) = delete;
+
+public:
+	ArenaScope(): m_arena(ThreadArena()), m_mark(m_arena.Position()) {}
+	explicit ArenaScope(MonotonicArena& arena): m_arena(arena), m_mark(arena.Position()) {}
+	~ArenaScope() { m_arena.Rewind(m_mark); }
+};
+
+
+// Standard allocator on a MonotonicArena, by default that of the constructing
+// thread. Copies of a container take the arena of the thread that copies.
+template <class V, std::size_t Alignment = 64>
+class ArenaAllocator
+{
+private:
+	template <class U, std::size_t A> friend class ArenaAllocator;
+
+	MonotonicArena* m_arena;
+
+public:
+	typedef V value_type;
+
+	typedef std::true_type propagate_on_container_move_assignment;
+	typedef std::true_type propagate_on_container_swap;
+
+	template <class U> struct rebind { typedef ArenaAllocator<U, Alignment> other; };
+
+	ArenaAllocator(): m_arena(&ThreadArena()) {}
+	explicit ArenaAllocator(MonotonicArena& arena): m_arena(&arena) {}
+	template <class U> ArenaAllocator(const ArenaAllocator<U, Alignment>& source): m_arena(source.m_arena) {}
+
+	ArenaAllocator select_on_container_copy_construction() const { return ArenaAllocator(); }
+
+	V* allocate(std::size_t n)
+	{
+		return static_cast<V*>(m_arena->Allocate(n * sizeof(V), Alignment < alignof(V) ? alignof(V) : Alignment));
+	}
+
+	void deallocate(V* p, std::size_t n)
+	{
+		m_arena->Deallocate(p, n * sizeof(V));
+	}
+
+	template <class U> bool operator == (const ArenaAllocator<U, Alignment>& other) const { return m_arena == other.m_arena; }
+	template <class U> bool operator != (const ArenaAllocator<U, Alignment>& other) const { return m_arena != other.m_arena; }
+};
+
+#endif	// ArenaAllocator_hpp
@@ -9,6 +9,8 @@
 // 2002-1-21 DD indexing starts at 1
 // 2002-3-30 DD operator [] incorrectly implemented; corrected
 // 2005-12-17 DD size_t --> I
+// 2026-10-19 move constructor and assignment; structure built in place
+// 2026-10-19 operator [] not virtual
 //
 // (C) Datasim Component Technology 1999-2006
 
@@ -28,28 +30,19 @@ Array<V, I, S>::Array()
 }
 
 template <class V, class I, class S>
-Array<V, I, S>::Array(I size)
+Array<V, I, S>::Array(I size): m_structure(size_t(size)), m_start(1)
 { // Constructor with size. Start index=1.
-
-	m_structure=S(size_t(size));
-	m_start=1;
 }
 
 template <class V, class I, class S>
-Array<V, I, S>::Array(I size, I start)
+Array<V, I, S>::Array(I size, I start): m_structure(size_t(size)), m_start(start)
 { // Constructor with size & start index
-
-	m_structure=S(size_t(size));
-	m_start=start;
 }
 
 template <class V, class I, class S>
-Array<V, I, S>::Array(I size, I start, const V& value)
+Array<V, I, S>::Array(I size, I start, const V& value): m_structure(size_t(size)), m_start(start)
 { // Constructor with size & start index
 
-	m_structure=S(size_t(size));
-	m_start=start;
-
 	// Initialise array elements
 	for (I i = MinIndex(); i <= MaxIndex(); i++) (*this)[i] = value;
 }
@@ -63,6 +56,12 @@ Array<V, I, S>::Array(const Array<V, I, S>& source)
 	m_start=source.m_start;
 }
 
+template <class V, class I, class S>
+Array<V, I, S>::Array(Array<V, I, S>&& source) noexcept
+	: m_structure(std::move(source.m_structure)), m_start(source.m_start)
+{ // Move constructor
+}
+
 template <class V, class I, class S>
 Array<V, I, S>::~Array()
 { // Destructor
@@ -70,21 +69,21 @@ Array<V, I, S>::~Array()
 
 // Selectors
 template <class V, class I, class S>
-I Array<V, I, S>::MinIndex() const
+inline I Array<V, I, S>::MinIndex() const
 { // Return the minimum index
 
 	return m_start;
 }
 
 template <class V, class I, class S>
-I Array<V, I, S>::MaxIndex() const
+inline I Array<V, I, S>::MaxIndex() const
 { // Return the maximum index
 
 	return m_start+Size()-1;
 }
 
 template <class V, class I, class S>
-I Array<V, I, S>::Size() const
+inline I Array<V, I, S>::Size() const
 { // The size of the array
 
 	return I(m_structure.Size());
@@ -120,5 +119,17 @@ Array<V, I, S>& Array<V, I, S>::operator = (const Array<V, I, S>& source)
 	return *this;
 }
 
+template <class V, class I, class S>
+Array<V, I, S>& Array<V, I, S>::operator = (Array<V, I, S>&& source) noexcept
+{ // Move assignment
+
+	if (this==&source) return *this;
+
+	m_structure=std::move(source.m_structure);
+	m_start=source.m_start;
+
+	return *this;
+}
+
 
 #endif	// DSArray_cpp
\ No newline at end of file
@@ -28,6 +28,7 @@ public:
 	Array(I size, I start);		// Constructor with size & start index
 	Array(I size, I start, const V& value);	// Size, start and value
 	Array(const Array<V, I, S>& source);		// Copy constructor
+	Array(Array<V, I, S>&& source) noexcept;	// Move constructor
 	virtual ~Array();					// Destructor
 
 	// Selectors
@@ -35,11 +36,15 @@ public:
 	I MaxIndex() const;								// Return the maximum index
 	I Size() const;							// The size of the array
 
+	V* Data() { return m_structure.Data(); }				// Contiguous elements (if S has them)
+	const V* Data() const { return m_structure.Data(); }
+
 	// Operators
-	virtual V& operator [] (I index);				// Subscripting operator
-	virtual const V& operator [] (I index) const;	// Subscripting operator
+	V& operator [] (I index);						// Subscripting operator (not virtual, inlined)
+	const V& operator [] (I index) const;			// Subscripting operator
 
 	Array<V, I, S>& operator = (const Array<V, I, S>& source);
+	Array<V, I, S>& operator = (Array<V, I, S>&& source) noexcept;	// Move assignment
 };
 
 #endif	// Array_hpp
\ No newline at end of file
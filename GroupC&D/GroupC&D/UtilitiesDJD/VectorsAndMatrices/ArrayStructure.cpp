@@ -5,6 +5,7 @@
 //
 // 28 january 1999	RD	Started
 // 2002-4-8 DD small changes
+// 2026-10-19 ArrayStructureBase
 //
 // (C) Datasim Component Technology 1999
 
@@ -72,4 +73,35 @@ ArrayStructure<V>& ArrayStructure<V>::operator = (const ArrayStructure<V>& sourc
 	return *this;
 }
 
+
+// ArrayStructureBase
+template <class D, class V>
+inline const V& ArrayStructureBase<D, V>::Element(size_t index) const
+{ // Get element at position
+
+	return Derived()[index];
+}
+
+template <class D, class V>
+inline size_t ArrayStructureBase<D, V>::MinIndex() const
+{ // Return the minimum index
+
+	// Always ONE
+	return 1;
+}
+
+template <class D, class V>
+inline size_t ArrayStructureBase<D, V>::MaxIndex() const
+{ // Return the maximum index
+
+	return Derived().Size();
+}
+
+template <class D, class V>
+inline void ArrayStructureBase<D, V>::Element(size_t index, const V& val)
+{ // Change element at position
+
+	Derived()[index]=val;
+}
+
 #endif	// ArrayStructure_cpp
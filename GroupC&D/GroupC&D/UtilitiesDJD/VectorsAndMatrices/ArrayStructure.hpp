@@ -4,11 +4,24 @@
 // A size_t is used for indexing. Indexing starts at 1 in this class and its
 // dervived classes. These derived classes must implement the indexing [] operator.
 //
+// ArrayStructureBase is the statically dispatched base of the storage classes
+// (FullArray). Size() and operator [] of the derived class are called directly,
+// so element access in Array and Vector inlines and loops can be vectorised.
+//
+// ArrayStructure is the original interface with virtual functions. It is kept
+// for code that needs run-time polymorphism (the rows of FullMatrix);
+// ArrayStructureAdapter<S> turns a storage class S into an ArrayStructure.
+//
+// 2026-10-19 static dispatch base and adapter
+//
 // (C) Datasim Component Technology 1999
 
 #ifndef ArrayStructure_hpp
 #define ArrayStructure_hpp
 
+#include <cstddef>
+#include <utility>
+
 template <class V>
 class ArrayStructure
 {
@@ -35,5 +48,51 @@ public:
 	ArrayStructure<V>& operator = (const ArrayStructure<V>& source);
 };
 
+
+// Base class of storage classes without virtual functions (CRTP). D must have
+// Size() and operator [].
+template <class D, class V>
+class ArrayStructureBase
+{
+public:
+	const D& Derived() const { return static_cast<const D&>(*this); }
+	D& Derived() { return static_cast<D&>(*this); }
+
+	// Selectors
+	const V& Element(size_t index) const;						// Get element at position
+
+	size_t MinIndex() const;									// Return the minimum index == 1
+	size_t MaxIndex() const;									// Return the maximum index == size
+
+	// Modifiers
+	void Element(size_t index, const V& val);					// Change element at position
+};
+
+
+// Storage class S used through the virtual ArrayStructure interface
+template <class S>
+class ArrayStructureAdapter: public S, public ArrayStructure<typename S::value_type>
+{
+public:
+	typedef typename S::value_type value_type;
+
+	// Constructors
+	ArrayStructureAdapter(): S() {}
+	explicit ArrayStructureAdapter(size_t size): S(size) {}
+	ArrayStructureAdapter(const S& source): S(source) {}
+	ArrayStructureAdapter(S&& source): S(std::move(source)) {}
+
+	// Selectors
+	using S::Element;
+	using S::MinIndex;
+	using S::MaxIndex;
+
+	virtual size_t Size() const { return S::Size(); }
+
+	// Operators
+	virtual value_type& operator[] (size_t index) { return S::operator[] (index); }
+	virtual const value_type& operator[] (size_t index) const { return S::operator[] (index); }
+};
+
 #endif	// ArrayStructure_hpp    
 
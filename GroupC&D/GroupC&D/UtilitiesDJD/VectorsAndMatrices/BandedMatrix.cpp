@@ -0,0 +1,199 @@
+// BandedMatrix.cpp
+//
+// Band matrix storage and its kernels.
+//
+// 2026-10-19 kick-off
+
+#ifndef BandedMatrix_cpp
+#define BandedMatrix_cpp
+
+#include "UtilitiesDJD/VectorsAndMatrices/BandedMatrix.hpp"
+#include <algorithm>
+#include <string>
+
+
+// Constructors & destructor
+template <class V, int KL, int KU, class TA>
+BandedMatrix<V, KL, KU, TA>::BandedMatrix(): m_data(W), nr(1), nc(1), m_outside(V(0))
+{ // Default constructor
+}
+
+template <class V, int KL, int KU, class TA>
+BandedMatrix<V, KL, KU, TA>::BandedMatrix(size_t rows, size_t columns)
+	: m_data(rows * W), nr(rows), nc(columns), m_outside(V(0))
+{ // Constructor with size
+}
+
+template <class V, int KL, int KU, class TA>
+BandedMatrix<V, KL, KU, TA>::BandedMatrix(const BandedMatrix<V, KL, KU, TA>& source)
+	: m_data(source.m_data), nr(source.nr), nc(source.nc), m_outside(V(0))
+{ // Copy constructor
+}
+
+template <class V, int KL, int KU, class TA>
+BandedMatrix<V, KL, KU, TA>::BandedMatrix(BandedMatrix<V, KL, KU, TA>&& source) noexcept
+	: m_data(std::move(source.m_data)), nr(source.nr), nc(source.nc), m_outside(V(0))
+{ // Move constructor
+}
+
+template <class V, int KL, int KU, class TA>
+BandedMatrix<V, KL, KU, TA>::~BandedMatrix()
+{ // Destructor
+}
+
+// Operators
+template <class V, int KL, int KU, class TA>
+BandedMatrix<V, KL, KU, TA>& BandedMatrix<V, KL, KU, TA>::operator = (const BandedMatrix<V, KL, KU, TA>& source)
+{ // Assignment operator
+
+	// Exit if same object
+	if (this==&source) return *this;
+
+	m_data = source.m_data;
+
+	nr = source.nr; nc = source.nc;
+
+	return *this;
+}
+
+template <class V, int KL, int KU, class TA>
+BandedMatrix<V, KL, KU, TA>& BandedMatrix<V, KL, KU, TA>::operator = (BandedMatrix<V, KL, KU, TA>&& source) noexcept
+{ // Move assignment
+
+	if (this==&source) return *this;
+
+	m_data = std::move(source.m_data);
+
+	nr = source.nr; nc = source.nc;
+
+	return *this;
+}
+
+// Kernels
+template <class V, int KL, int KU, class TA>
+void BandedMatrix<V, KL, KU, TA>::Multiply(const V* x, V* y) const
+{ // y = A x; rows whose band lies inside the matrix use a loop of fixed length W
+
+	for (size_t i = 0; i < nr; ++i)
+	{
+		const V* row = m_data.data() + i * W;
+
+		if (i >= size_t(KL) && i + KU < nc)
+		{
+			const V* xi = x + (i - KL);
+			V sum = row[0] * xi[0];
+			for (int d = 1; d < W; ++d) sum += row[d] * xi[d];
+			y[i] = sum;
+		}
+		else
+		{
+			size_t jlo = (i > size_t(KL)) ? i - KL : 0;
+			size_t jhi = std::min(nc, i + KU + 1);
+
+			V sum = V(0);
+			for (size_t j = jlo; j < jhi; ++j) sum += row[j + KL - i] * x[j];
+			y[i] = sum;
+		}
+	}
+}
+
+template <class V, int KL, int KU, class TA>
+void BandedMatrix<V, KL, KU, TA>::SolveLower(const V* b, V* x, bool unitDiagonal) const
+{ // Forward substitution, L x = b
+
+	for (size_t i = 0; i < nr; ++i)
+	{
+		V sum = b[i];
+		for (size_t j = (i > size_t(KL)) ? i - KL : 0; j < i; ++j) sum -= At(i, j) * x[j];
+
+		if (unitDiagonal)
+		{
+			x[i] = sum;
+			continue;
+		}
+
+		if (At(i, i) == V(0))
+		{
+			throw DatasimException("Zero diagonal element", "BandedMatrix::SolveLower", "Row " + std::to_string(i + 1));
+		}
+
+		x[i] = sum / At(i, i);
+	}
+}
+
+template <class V, int KL, int KU, class TA>
+void BandedMatrix<V, KL, KU, TA>::SolveUpper(const V* b, V* x, bool unitDiagonal) const
+{ // Back substitution, U x = b
+
+	for (size_t i = nr; i-- > 0; )
+	{
+		V sum = b[i];
+		for (size_t j = i + 1; j < std::min(nc, i + KU + 1); ++j) sum -= At(i, j) * x[j];
+
+		if (unitDiagonal)
+		{
+			x[i] = sum;
+			continue;
+		}
+
+		if (At(i, i) == V(0))
+		{
+			throw DatasimException("Zero diagonal element", "BandedMatrix::SolveUpper", "Row " + std::to_string(i + 1));
+		}
+
+		x[i] = sum / At(i, i);
+	}
+}
+
+template <class V, int KL, int KU, class TA>
+BandedMatrix<V, KL, KU, TA> BandedMatrix<V, KL, KU, TA>::LUFactors() const
+{ // Doolittle without pivoting; L (unit diagonal, not stored) below the diagonal, U on and above it.
+  // Suitable for the diagonally dominant matrices of implicit schemes.
+
+	if (nr != nc)
+	{
+		throw DatasimException("Matrix is not square", "BandedMatrix::LUFactors",
+								std::to_string(nr) + " x " + std::to_string(nc));
+	}
+
+	BandedMatrix<V, KL, KU, TA> lu(*this);
+	size_t n = nr;
+
+	for (size_t k = 0; k < n; ++k)
+	{
+		V pivot = lu.At(k, k);
+		if (pivot == V(0))
+		{
+			throw DatasimException("Zero pivot", "BandedMatrix::LUFactors", "Row " + std::to_string(k + 1));
+		}
+
+		size_t iend = std::min(n, k + KL + 1), jend = std::min(n, k + KU + 1);
+		for (size_t i = k + 1; i < iend; ++i)
+		{
+			V l = lu.At(i, k) / pivot;
+			lu.At(i, k) = l;
+
+			for (size_t j = k + 1; j < jend; ++j) lu.At(i, j) -= l * lu.At(k, j);
+		}
+	}
+
+	return lu;
+}
+
+template <class V, int KL, int KU, class TA>
+void BandedMatrix<V, KL, KU, TA>::SolveFactored(const V* b, V* x) const
+{ // L U x = b
+
+	SolveLower(b, x, true);
+	SolveUpper(x, x);
+}
+
+template <class V, int KL, int KU, class TA>
+void BandedMatrix<V, KL, KU, TA>::Solve(const V* b, V* x) const
+{ // A x = b
+
+	LUFactors().SolveFactored(b, x);
+}
+
+
+#endif	// BandedMatrix_cpp
@@ -0,0 +1,149 @@
+// BandedMatrix.hpp
+//
+// Band matrix storage for use as the S argument of Matrix and NumericMatrix.
+// Only the KL sub-diagonals, the diagonal and the KU super-diagonals are kept,
+// row after row in one buffer of Rows() * (KL + KU + 1) elements, so a J x J
+// tridiagonal operator needs 3J elements instead of J^2.
+//
+// Indexing starts at 1. Elements outside the band read as zero and writes to
+// them are discarded, so generic code that visits every element still works.
+//
+// The kernels work on zero-based contiguous arrays:
+//
+//	Multiply		y = A x in O(Rows() * (KL + KU + 1))
+//	SolveLower		forward substitution with the lower triangle of the band
+//	SolveUpper		back substitution with the upper triangle of the band
+//	LUFactors		LU factorisation without pivoting; L and U fit in the same band
+//	SolveFactored	solve with the factors, i.e. the Thomas algorithm for KL = KU = 1
+//
+// 2026-10-19 kick-off
+//
+
+#ifndef BandedMatrix_hpp
+#define BandedMatrix_hpp
+
+#include <vector>
+#include <cstddef>
+#include "UtilitiesDJD/VectorsAndMatrices/AlignedAllocator.hpp"
+#include "UtilitiesDJD/ExceptionClasses/DatasimException.hpp"
+
+
+template <class TValue, int KL, int KU, class TA=AlignedAllocator<TValue> >
+class BandedMatrix
+{
+public:
+	static const int W = KL + KU + 1;	// Stored elements per row
+
+	// Handle to one row; indexing starts at 1
+	class RowReference
+	{
+	private:
+		TValue* m_row;			// Element (i, i - KL) of this row
+		size_t m_index;
+		TValue* m_outside;		// Sink for writes outside the band
+
+	public:
+		RowReference(TValue* row, size_t index, TValue* outside): m_row(row), m_index(index), m_outside(outside) {}
+
+		TValue& operator[] (size_t column) const
+		{
+			long d = long(column) - long(m_index) + KL;
+			if (d >= 0 && d < W) return m_row[d];
+
+			*m_outside = TValue(0);
+			return *m_outside;
+		}
+	};
+
+	class ConstRowReference
+	{
+	private:
+		const TValue* m_row;
+		size_t m_index;
+
+	public:
+		ConstRowReference(const TValue* row, size_t index): m_row(row), m_index(index) {}
+
+		const TValue& operator[] (size_t column) const
+		{
+			static const TValue zero = TValue(0);
+
+			long d = long(column) - long(m_index) + KL;
+			return (d >= 0 && d < W) ? m_row[d] : zero;
+		}
+	};
+
+private:
+	std::vector<TValue, TA> m_data;		// Row i starts at (i-1) * W; its element j at (j-i+KL)
+
+	size_t nr, nc;
+	TValue m_outside;
+
+	// Zero-based access inside the band
+	TValue& At(size_t i, size_t j) { return m_data[i * W + (j + KL - i)]; }
+	const TValue& At(size_t i, size_t j) const { return m_data[i * W + (j + KL - i)]; }
+
+public:
+	// Constructors & destructor
+	BandedMatrix();												// Default constructor (1 X 1)
+	BandedMatrix(size_t rows, size_t columns);					// Constructor with size, all zero
+	BandedMatrix(const BandedMatrix<TValue, KL, KU, TA>& source);	// Copy constructor
+	BandedMatrix(BandedMatrix<TValue, KL, KU, TA>&& source) noexcept;	// Move constructor
+	virtual ~BandedMatrix();										// Destructor
+
+	// Selectors
+	size_t Rows() const { return nr; }							// Number of rows
+	size_t Columns() const { return nc; }						// Number of columns
+
+	size_t MinRowIndex() const { return 1; }
+	size_t MaxRowIndex() const { return nr; }
+	size_t MinColumnIndex() const { return 1; }
+	size_t MaxColumnIndex() const { return nc; }
+
+	static int LowerBandwidth() { return KL; }
+	static int UpperBandwidth() { return KU; }
+
+	const TValue& Element(size_t row, size_t column) const { return (*this)[row][column]; }
+
+	// Raw access; row i (from 1) starts at Data()[(i-1) * W], element (i, j) is at offset j - i + KL
+	TValue* Data() { return m_data.data(); }
+	const TValue* Data() const { return m_data.data(); }
+
+	// Modifiers
+	void Element(size_t row, size_t column, const TValue& val) { (*this)[row][column] = val; }
+
+	// Operators
+	RowReference operator[] (size_t row)
+	{ // Subscripting operator
+
+		return RowReference(m_data.data() + (row - 1) * W, row, &m_outside);
+	}
+
+	ConstRowReference operator[] (size_t row) const
+	{ // Subscripting operator
+
+		return ConstRowReference(m_data.data() + (row - 1) * W, row);
+	}
+
+	BandedMatrix<TValue, KL, KU, TA>& operator = (const BandedMatrix<TValue, KL, KU, TA>& source);
+	BandedMatrix<TValue, KL, KU, TA>& operator = (BandedMatrix<TValue, KL, KU, TA>&& source) noexcept;
+
+	// Kernels; x and b may be the same array in the solves
+	void Multiply(const TValue* x, TValue* y) const;						// y = A x
+	void SolveLower(const TValue* b, TValue* x, bool unitDiagonal = false) const;
+	void SolveUpper(const TValue* b, TValue* x, bool unitDiagonal = false) const;
+
+	BandedMatrix<TValue, KL, KU, TA> LUFactors() const;						// Square matrices only
+	void SolveFactored(const TValue* b, TValue* x) const;					// *this holds LUFactors()
+	void Solve(const TValue* b, TValue* x) const;							// Factor, then solve
+};
+
+// The band matrices of 1D and 2D (one direction at a time) finite differences
+template <class TValue, class TA=AlignedAllocator<TValue> >
+	using TridiagonalMatrix = BandedMatrix<TValue, 1, 1, TA>;
+
+template <class TValue, class TA=AlignedAllocator<TValue> >
+	using PentadiagonalMatrix = BandedMatrix<TValue, 2, 2, TA>;
+
+
+#endif	// BandedMatrix_hpp
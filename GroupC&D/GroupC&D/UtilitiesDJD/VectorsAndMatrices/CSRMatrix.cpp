@@ -0,0 +1,206 @@
+// CSRMatrix.cpp
+//
+// Compressed sparse row storage and its kernels.
+//
+// 2026-10-19 kick-off
+
+#ifndef CSRMatrix_cpp
+#define CSRMatrix_cpp
+
+#include "UtilitiesDJD/VectorsAndMatrices/CSRMatrix.hpp"
+#include <algorithm>
+#include <string>
+
+
+// Constructors & destructor
+template <class V, class TA>
+CSRMatrix<V, TA>::CSRMatrix(): m_rowStart(2, 0), m_open(0), nr(1), nc(1)
+{ // Default constructor
+}
+
+template <class V, class TA>
+CSRMatrix<V, TA>::CSRMatrix(size_t rows, size_t columns): m_rowStart(rows + 1, 0), m_open(0), nr(rows), nc(columns)
+{ // Constructor with size
+}
+
+template <class V, class TA>
+CSRMatrix<V, TA>::CSRMatrix(const CSRMatrix<V, TA>& source)
+	: m_rowStart(source.m_rowStart), m_columns(source.m_columns), m_values(source.m_values), m_open(source.m_open),
+	  nr(source.nr), nc(source.nc)
+{ // Copy constructor
+}
+
+template <class V, class TA>
+CSRMatrix<V, TA>::CSRMatrix(CSRMatrix<V, TA>&& source) noexcept
+	: m_rowStart(std::move(source.m_rowStart)), m_columns(std::move(source.m_columns)), m_values(std::move(source.m_values)),
+	  m_open(source.m_open), nr(source.nr), nc(source.nc)
+{ // Move constructor
+}
+
+template <class V, class TA>
+CSRMatrix<V, TA>::~CSRMatrix()
+{ // Destructor
+}
+
+// Selectors
+template <class V, class TA>
+size_t CSRMatrix<V, TA>::Position(size_t i, size_t j) const
+{ // Binary search in row i
+
+	return size_t(std::lower_bound(m_columns.begin() + RowBegin(i), m_columns.begin() + RowEnd(i), j) - m_columns.begin());
+}
+
+template <class V, class TA>
+const V& CSRMatrix<V, TA>::Find(size_t i, size_t j) const
+{ // Stored value or zero
+
+	static const V zero = V(0);
+
+	size_t p = Position(i, j);
+	return (p < RowEnd(i) && m_columns[p] == j) ? m_values[p] : zero;
+}
+
+template <class V, class TA>
+V& CSRMatrix<V, TA>::Entry(size_t i, size_t j)
+{ // Stored value, created (as zero) if absent
+
+	if (i > m_open)
+	{ // Open a later row; the rows in between are empty
+
+		for (size_t k = m_open + 1; k <= i; ++k) m_rowStart[k] = m_values.size();
+		m_open = i;
+	}
+
+	size_t p = Position(i, j);
+	if (p < RowEnd(i) && m_columns[p] == j) return m_values[p];
+
+	// Insert; the later open rows move up by one. At the end of the last open row,
+	// which is where ordered assembly writes, this is an append.
+	m_columns.insert(m_columns.begin() + p, j);
+	m_values.insert(m_values.begin() + p, V(0));
+	for (size_t k = i + 1; k <= m_open; ++k) ++m_rowStart[k];
+
+	return m_values[p];
+}
+
+// Modifiers
+template <class V, class TA>
+void CSRMatrix<V, TA>::Reserve(size_t nonZeros)
+{ // Room for entries during assembly
+
+	m_columns.reserve(nonZeros);
+	m_values.reserve(nonZeros);
+}
+
+// Operators
+template <class V, class TA>
+CSRMatrix<V, TA>& CSRMatrix<V, TA>::operator = (const CSRMatrix<V, TA>& source)
+{ // Assignment operator
+
+	// Exit if same object
+	if (this==&source) return *this;
+
+	m_rowStart = source.m_rowStart;
+	m_columns = source.m_columns;
+	m_values = source.m_values;
+	m_open = source.m_open;
+
+	nr = source.nr; nc = source.nc;
+
+	return *this;
+}
+
+template <class V, class TA>
+CSRMatrix<V, TA>& CSRMatrix<V, TA>::operator = (CSRMatrix<V, TA>&& source) noexcept
+{ // Move assignment
+
+	if (this==&source) return *this;
+
+	m_rowStart = std::move(source.m_rowStart);
+	m_columns = std::move(source.m_columns);
+	m_values = std::move(source.m_values);
+	m_open = source.m_open;
+
+	nr = source.nr; nc = source.nc;
+
+	return *this;
+}
+
+// Kernels
+template <class V, class TA>
+void CSRMatrix<V, TA>::Multiply(const V* x, V* y) const
+{ // y = A x
+
+	const size_t* col = m_columns.data();
+	const V* val = m_values.data();
+
+	for (size_t i = 0; i < nr; ++i)
+	{
+		V sum = V(0);
+		for (size_t p = RowBegin(i), end = RowEnd(i); p < end; ++p) sum += val[p] * x[col[p]];
+		y[i] = sum;
+	}
+}
+
+template <class V, class TA>
+void CSRMatrix<V, TA>::SolveLower(const V* b, V* x, bool unitDiagonal) const
+{ // Forward substitution; entries above the diagonal are ignored
+
+	for (size_t i = 0; i < nr; ++i)
+	{
+		V sum = b[i];
+		V diagonal = V(0);
+
+		for (size_t p = RowBegin(i), end = RowEnd(i); p < end && m_columns[p] <= i; ++p)
+		{
+			if (m_columns[p] == i) diagonal = m_values[p];
+			else sum -= m_values[p] * x[m_columns[p]];
+		}
+
+		if (unitDiagonal)
+		{
+			x[i] = sum;
+			continue;
+		}
+
+		if (diagonal == V(0))
+		{
+			throw DatasimException("Zero or missing diagonal element", "CSRMatrix::SolveLower", "Row " + std::to_string(i + 1));
+		}
+
+		x[i] = sum / diagonal;
+	}
+}
+
+template <class V, class TA>
+void CSRMatrix<V, TA>::SolveUpper(const V* b, V* x, bool unitDiagonal) const
+{ // Back substitution; entries below the diagonal are ignored
+
+	for (size_t i = nr; i-- > 0; )
+	{
+		V sum = b[i];
+		V diagonal = V(0);
+
+		for (size_t p = Position(i, i), end = RowEnd(i); p < end; ++p)
+		{
+			if (m_columns[p] == i) diagonal = m_values[p];
+			else sum -= m_values[p] * x[m_columns[p]];
+		}
+
+		if (unitDiagonal)
+		{
+			x[i] = sum;
+			continue;
+		}
+
+		if (diagonal == V(0))
+		{
+			throw DatasimException("Zero or missing diagonal element", "CSRMatrix::SolveUpper", "Row " + std::to_string(i + 1));
+		}
+
+		x[i] = sum / diagonal;
+	}
+}
+
+
+#endif	// CSRMatrix_cpp
@@ -0,0 +1,131 @@
+// CSRMatrix.hpp
+//
+// Compressed sparse row storage for use as the S argument of Matrix and
+// NumericMatrix. Only the entries that have been written are stored: per row
+// a run of (column, value) pairs sorted by column, the runs one after the
+// other. Memory is O(Rows() + NonZeros()), e.g. 5 entries per row for the
+// 5-point operator of a 2D PDE.
+//
+// Indexing starts at 1. Reading an entry that is not stored gives zero.
+// Non-const access creates the entry if needed, so assembly is a sequence of
+// m(i, j) = value or m(i, j) += value. Entries are appended in O(1) when the
+// rows are filled in order and the columns of a row in increasing order,
+// otherwise an insertion moves the entries after it. As with std::vector,
+// creating an entry invalidates references to others. Generic code that
+// writes every element (Transpose, matrix expressions) creates every entry;
+// use the kernels below for sparse work.
+//
+// The kernels work on zero-based contiguous arrays:
+//
+//	Multiply		y = A x in O(Rows() + NonZeros())
+//	SolveLower		forward substitution with the entries on and below the diagonal
+//	SolveUpper		back substitution with the entries on and above the diagonal
+//
+// 2026-10-19 kick-off
+//
+
+#ifndef CSRMatrix_hpp
+#define CSRMatrix_hpp
+
+#include <vector>
+#include <cstddef>
+#include "UtilitiesDJD/ExceptionClasses/DatasimException.hpp"
+
+
+template <class TValue, class TA=std::allocator<TValue> >
+class CSRMatrix
+{
+public:
+	// Handle to one row; indexing starts at 1
+	class RowReference
+	{
+	private:
+		CSRMatrix<TValue, TA>* m_matrix;
+		size_t m_row;
+
+	public:
+		RowReference(CSRMatrix<TValue, TA>* matrix, size_t row): m_matrix(matrix), m_row(row) {}
+
+		TValue& operator[] (size_t column) const { return m_matrix->Entry(m_row - 1, column - 1); }
+	};
+
+	class ConstRowReference
+	{
+	private:
+		const CSRMatrix<TValue, TA>* m_matrix;
+		size_t m_row;
+
+	public:
+		ConstRowReference(const CSRMatrix<TValue, TA>* matrix, size_t row): m_matrix(matrix), m_row(row) {}
+
+		const TValue& operator[] (size_t column) const { return m_matrix->Find(m_row - 1, column - 1); }
+	};
+
+private:
+	// Row i has entries [RowBegin(i), RowEnd(i)) of m_columns and m_values (zero-based).
+	// Rows after m_open have no entries yet and their m_rowStart is not maintained.
+	std::vector<size_t> m_rowStart;
+	std::vector<size_t> m_columns;
+	std::vector<TValue, TA> m_values;
+	size_t m_open;
+
+	size_t nr, nc;
+
+	size_t RowBegin(size_t i) const { return (i <= m_open) ? m_rowStart[i] : m_values.size(); }
+	size_t RowEnd(size_t i) const { return (i < m_open) ? m_rowStart[i + 1] : m_values.size(); }
+
+	size_t Position(size_t i, size_t j) const;		// Position of (i, j) in its row, or where it would go
+
+public:
+	// Constructors & destructor
+	CSRMatrix();												// Default constructor (1 X 1, no entries)
+	CSRMatrix(size_t rows, size_t columns);						// Constructor with size, no entries
+	CSRMatrix(const CSRMatrix<TValue, TA>& source);				// Copy constructor
+	CSRMatrix(CSRMatrix<TValue, TA>&& source) noexcept;			// Move constructor
+	virtual ~CSRMatrix();										// Destructor
+
+	// Selectors
+	size_t Rows() const { return nr; }							// Number of rows
+	size_t Columns() const { return nc; }						// Number of columns
+	size_t NonZeros() const { return m_values.size(); }			// Number of stored entries
+
+	size_t MinRowIndex() const { return 1; }
+	size_t MaxRowIndex() const { return nr; }
+	size_t MinColumnIndex() const { return 1; }
+	size_t MaxColumnIndex() const { return nc; }
+
+	const TValue& Element(size_t row, size_t column) const { return Find(row - 1, column - 1); }
+
+	// Zero-based
+	const TValue& Find(size_t i, size_t j) const;				// Stored value or zero
+	TValue& Entry(size_t i, size_t j);							// Stored value, created if absent
+
+	// Modifiers
+	void Element(size_t row, size_t column, const TValue& val) { Entry(row - 1, column - 1) = val; }
+	void Reserve(size_t nonZeros);								// Room for entries during assembly
+
+	// Operators
+	RowReference operator[] (size_t row)
+	{ // Subscripting operator
+
+		return RowReference(this, row);
+	}
+
+	ConstRowReference operator[] (size_t row) const
+	{ // Subscripting operator
+
+		return ConstRowReference(this, row);
+	}
+
+	CSRMatrix<TValue, TA>& operator = (const CSRMatrix<TValue, TA>& source);
+	CSRMatrix<TValue, TA>& operator = (CSRMatrix<TValue, TA>&& source) noexcept;
+
+	// Kernels; x and b may be the same array in the solves. The triangular solves need
+	// a stored, non-zero diagonal unless unitDiagonal is set.
+	void Multiply(const TValue* x, TValue* y) const;						// y = A x
+	void SolveLower(const TValue* b, TValue* x, bool unitDiagonal = false) const;
+	void SolveUpper(const TValue* b, TValue* x, bool unitDiagonal = false) const;
+};
+
+
+#endif	// CSRMatrix_hpp
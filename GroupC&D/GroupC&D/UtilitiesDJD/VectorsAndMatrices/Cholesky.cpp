@@ -0,0 +1,75 @@
+// Cholesky.cpp
+//
+// Cholesky factorisation, row by row (Cholesky-Banachiewicz).
+//
+// 2026-10-19 kick-off
+//
+
+#ifndef Cholesky_cpp
+#define Cholesky_cpp
+
+#include "UtilitiesDJD/VectorsAndMatrices/Cholesky.hpp"
+#include <cmath>
+#include <string>
+
+// Factor the n x n matrix given by c(i, j) into l(i, j), zero-based indices
+template <class V, class InC, class OutL>
+	void choleskyRows(std::size_t n, const InC& c, const OutL& l, const char* method)
+{
+	for (std::size_t i = 0; i < n; ++i)
+	{
+		for (std::size_t j = 0; j <= i; ++j)
+		{
+			V sum = c(i, j);
+			for (std::size_t k = 0; k < j; ++k) sum -= l(i, k) * l(j, k);
+
+			if (i == j)
+			{
+				if (!(sum > V(0)))
+				{
+					throw DatasimException("Matrix is not positive definite", method,
+											"Pivot " + std::to_string(i + 1) + " is " + std::to_string(sum));
+				}
+
+				l(i, i) = std::sqrt(sum);
+			}
+			else
+			{
+				l(i, j) = sum / l(j, j);
+			}
+		}
+
+		for (std::size_t j = i + 1; j < n; ++j) l(i, j) = V(0);
+	}
+}
+
+template <class V, class I, class S>
+	NumericMatrix<V, I> CholeskyFactor(const NumericMatrix<V, I, S>& C)
+{ // Run-time size
+
+	NumericMatrix<V, I> L(C.Rows(), C.Columns(), C.MinRowIndex(), C.MinColumnIndex());
+
+	I r0 = C.MinRowIndex(), c0 = C.MinColumnIndex();
+	choleskyRows<V>(std::size_t(C.Rows()),
+		[&C, r0, c0](std::size_t i, std::size_t j) { return C(r0 + I(i), c0 + I(j)); },
+		[&L, r0, c0](std::size_t i, std::size_t j) -> V& { return L(r0 + I(i), c0 + I(j)); },
+		"CholeskyFactor(NumericMatrix)");
+
+	return L;
+}
+
+template <typename V, int N>
+	MatrixVectorSpace<V, N, N> CholeskyFactor(const MatrixVectorSpace<V, N, N>& C)
+{ // Compile-time size
+
+	MatrixVectorSpace<V, N, N> L;
+
+	choleskyRows<V>(std::size_t(N),
+		[&C](std::size_t i, std::size_t j) { return C.mat[i][j]; },
+		[&L](std::size_t i, std::size_t j) -> V& { return L.mat[i][j]; },
+		"CholeskyFactor(MatrixVectorSpace)");
+
+	return L;
+}
+
+#endif	// Cholesky_cpp
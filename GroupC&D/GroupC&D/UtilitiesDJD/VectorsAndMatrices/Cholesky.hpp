@@ -0,0 +1,27 @@
+// Cholesky.hpp
+//
+// Cholesky factorisation C = L * transpose(L) of a symmetric positive definite
+// matrix, e.g. a correlation matrix. L is lower triangular; its upper part is
+// zero. Only the lower triangle of C is read.
+//
+// Both the run-time NumericMatrix and the compile-time MatrixVectorSpace are
+// supported. A matrix that is not positive definite raises a DatasimException.
+//
+// 2026-10-19 kick-off
+//
+
+#ifndef Cholesky_hpp
+#define Cholesky_hpp
+
+#include "UtilitiesDJD/VectorsAndMatrices/NumericMatrix.cpp"
+#include "UtilitiesDJD/CompileTimeVectorsAndMatrices/MatrixVectorSpace.cpp"
+#include "UtilitiesDJD/ExceptionClasses/DatasimException.hpp"
+
+// L has the same index ranges as C
+template <class V, class I, class S>
+	NumericMatrix<V, I> CholeskyFactor(const NumericMatrix<V, I, S>& C);
+
+template <typename V, int N>
+	MatrixVectorSpace<V, N, N> CholeskyFactor(const MatrixVectorSpace<V, N, N>& C);
+
+#endif	// Cholesky_hpp
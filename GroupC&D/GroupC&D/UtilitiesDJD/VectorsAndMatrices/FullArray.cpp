@@ -4,6 +4,8 @@
 //
 // 28 january 1999	RD	Started
 // 2002-1-21 Indexes starting at 1
+// 2026-10-19 move constructor and assignment; size constructor without a temporary
+// 2026-10-19 static dispatch through ArrayStructureBase
 //
 //
 // (C) Datasim Component Technology 1999
@@ -15,26 +17,30 @@
 
 // Constructors & destructor
 template <class V, class TA>
-FullArray<V, TA>::FullArray(): ArrayStructure<V>()
+FullArray<V, TA>::FullArray(): ArrayStructureBase<FullArray<V, TA>, V>()
 { // Default constructor
 
 	m_vector=std::vector<V, TA>(1);	// vector object with 1 element
 }
 
 template <class V, class TA>
-FullArray<V, TA>::FullArray(size_t size): ArrayStructure<V>()
+FullArray<V, TA>::FullArray(size_t size): ArrayStructureBase<FullArray<V, TA>, V>(), m_vector(size)
 { // Constructor with size
-
-	m_vector=std::vector<V, TA>(size);
 }
 
 template <class V, class TA>
-FullArray<V, TA>::FullArray(const FullArray<V, TA>& source): ArrayStructure<V>(source)
+FullArray<V, TA>::FullArray(const FullArray<V, TA>& source): ArrayStructureBase<FullArray<V, TA>, V>(source)
 { // Copy constructor
 
 	m_vector=source.m_vector;
 }
 
+template <class V, class TA>
+FullArray<V, TA>::FullArray(FullArray<V, TA>&& source) noexcept
+	: ArrayStructureBase<FullArray<V, TA>, V>(source), m_vector(std::move(source.m_vector))
+{ // Move constructor; source is left empty
+}
+
 template <class V, class TA>
 FullArray<V, TA>::~FullArray()
 { // Destructor
@@ -42,7 +48,7 @@ FullArray<V, TA>::~FullArray()
 
 // Selectors
 template <class V, class TA>
-size_t FullArray<V, TA>::Size() const
+inline size_t FullArray<V, TA>::Size() const
 { // Size of the array
 
 	return m_vector.size();
@@ -53,7 +59,7 @@ size_t FullArray<V, TA>::Size() const
 
 // Operators
 template <class V, class TA>
-V& FullArray<V, TA>::operator[] (size_t index)
+inline V& FullArray<V, TA>::operator[] (size_t index)
 { // Subscripting operator
 
 
@@ -61,7 +67,7 @@ V& FullArray<V, TA>::operator[] (size_t index)
 }
 
 template <class V, class TA>
-const V& FullArray<V, TA>::operator[] (size_t index) const
+inline const V& FullArray<V, TA>::operator[] (size_t index) const
 { // Subscripting operator
 
 
@@ -75,9 +81,6 @@ FullArray<V, TA>& FullArray<V, TA>::operator = (const FullArray<V, TA>& source)
 	// Exit if same object
 	if (this==&source) return *this;
 
-	// Call base class constructor
-	ArrayStructure<V>::operator = (source);
-
 	// Copy the embedded vector
 	m_vector=source.m_vector;
 
@@ -85,4 +88,16 @@ FullArray<V, TA>& FullArray<V, TA>::operator = (const FullArray<V, TA>& source)
 }
 
 
+template <class V, class TA>
+FullArray<V, TA>& FullArray<V, TA>::operator = (FullArray<V, TA>&& source) noexcept
+{ // Move assignment; source is left empty
+
+	if (this==&source) return *this;
+
+	m_vector=std::move(source.m_vector);
+
+	return *this;
+}
+
+
 #endif // FullArray_cpp
\ No newline at end of file
@@ -2,6 +2,9 @@
 //
 // Template class for a full (non-sparse) arrays.
 //
+// FullArray has no virtual functions; use ArrayStructureAdapter<FullArray<V, TA> >
+// where an ArrayStructure<V> is needed.
+//
 // (C) Datasim Component Technology 1999
 
 #ifndef FullArray_hpp
@@ -13,20 +16,26 @@
 
 
 template <class V, class TA=std::allocator<V> >
-							class FullArray: public ArrayStructure<V>
+							class FullArray: public ArrayStructureBase<FullArray<V, TA>, V>
 {
 private:
 	std::vector<V, TA> m_vector;								// Use STL vector class for storage
 
 public:
+	typedef V value_type;
+
 	// Constructors & destructor
 	FullArray();											
 	FullArray(size_t size);									
 	FullArray(const FullArray<V, TA>& source);				
-	virtual ~FullArray();									
+	FullArray(FullArray<V, TA>&& source) noexcept;			// Move constructor
+	~FullArray();									
 
 	// Selectors
-	virtual size_t Size() const;
+	size_t Size() const;
+
+	V* Data() { return m_vector.data(); }					// Contiguous elements
+	const V* Data() const { return m_vector.data(); }
 
 	// Modifiers
 
@@ -35,6 +44,7 @@ public:
 	const V& operator[] (size_t index) const;				
 
 	FullArray<V, TA>& operator = (const FullArray<V, TA>& source);
+	FullArray<V, TA>& operator = (FullArray<V, TA>&& source) noexcept;		// Move assignment
 };
 
 
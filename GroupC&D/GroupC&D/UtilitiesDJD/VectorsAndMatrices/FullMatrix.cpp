@@ -4,6 +4,8 @@
 // A size_t is used for indexing. Indexing starts at 1.
 //
 // 2002-4-8 DD Another possibility FArray<FArray <TValue> >; Use or redundant values nr, nc
+// 2026-10-19 move constructor and assignment
+// 2026-10-19 rows are ArrayStructureAdapter<FullArray>
 //
 // (C) Datasim Component Technology 1999
 
@@ -17,20 +19,19 @@ template <class V, class TA>
 FullMatrix<V, TA>::FullMatrix(): MatrixStructure<V>()
 { // Default constructor
 
-	m_structure=FullArray<FullArray<V, TA>, std::allocator<FullArray<V, TA> > >();
+	m_structure=FullArray<Row, std::allocator<Row> >();
 
 	nr = nc = 1;
 }
 
 template <class V, class TA>
-FullMatrix<V, TA>::FullMatrix(size_t rows, size_t columns): MatrixStructure<V>()
+FullMatrix<V, TA>::FullMatrix(size_t rows, size_t columns): MatrixStructure<V>(), m_structure(rows)
 { // Constructor with size
 
 	// Create the rows
-	m_structure=FullArray<FullArray<V, TA>, std::allocator<FullArray<V, TA> > >(rows);
 
 	// Add the colums to the rows
-	for (size_t i=1; i<=m_structure.Size(); i++) m_structure[i]=FullArray<V, TA>(columns);
+	for (size_t i=1; i<=m_structure.Size(); i++) m_structure[i]=Row(columns);
 
 	nr = rows; nc = columns;
 }
@@ -41,7 +42,13 @@ FullMatrix<V, TA>::FullMatrix(const FullMatrix<V, TA>& source): MatrixStructure<
 
 	m_structure=source.m_structure;
 
-	nr = sopurce.nr; nc = source.nc;
+	nr = source.nr; nc = source.nc;
+}
+
+template <class V, class TA>
+FullMatrix<V, TA>::FullMatrix(FullMatrix<V, TA>&& source) noexcept
+	: MatrixStructure<V>(source), m_structure(std::move(source.m_structure)), nr(source.nr), nc(source.nc)
+{ // Move constructor
 }
 
 template <class V, class TA>
@@ -97,6 +104,21 @@ FullMatrix<V, TA>& FullMatrix<V, TA>::operator = (const FullMatrix<V, TA>& sourc
 	return *this;
 }
 
+template <class V, class TA>
+FullMatrix<V, TA>& FullMatrix<V, TA>::operator = (FullMatrix<V, TA>&& source) noexcept
+{ // Move assignment
+
+	if (this==&source) return *this;
+
+	MatrixStructure<V>::operator = (source);
+
+	m_structure=std::move(source.m_structure);
+
+	nr = source.nr; nc = source.nc;
+
+	return *this;
+}
+
 
 
 #endif	// DSFullMatrix_cpp
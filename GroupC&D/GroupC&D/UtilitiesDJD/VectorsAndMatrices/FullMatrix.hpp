@@ -15,7 +15,10 @@
 template <class TValue, class TA=std::allocator<TValue> >
 class FullMatrix: public MatrixStructure<TValue>
 {
-	FullArray<FullArray<TValue, TA>, std::allocator<FullArray<TValue, TA> > > m_structure;
+	// Rows are used through the virtual ArrayStructure interface of MatrixStructure
+	typedef ArrayStructureAdapter<FullArray<TValue, TA> > Row;
+
+	FullArray<Row, std::allocator<Row> > m_structure;
 
 	// Redundant data 
 	size_t nr, nc;
@@ -25,6 +28,7 @@ public:
 	FullMatrix();													// Default constructor
 	FullMatrix(size_t rows, size_t columns);						// Constructor with size
 	FullMatrix(const FullMatrix<TValue, TA>& source);				// Copy constructor
+	FullMatrix(FullMatrix<TValue, TA>&& source) noexcept;			// Move constructor
 	virtual ~FullMatrix();											// Destructor
 
 	// Selectors
@@ -38,6 +42,7 @@ public:
 	virtual const ArrayStructure<TValue>& operator[] (size_t index) const;		// Subscripting operator
 
 	FullMatrix<TValue, TA>& operator = (const FullMatrix<TValue, TA>& source);
+	FullMatrix<TValue, TA>& operator = (FullMatrix<TValue, TA>&& source) noexcept;
 };
 
 
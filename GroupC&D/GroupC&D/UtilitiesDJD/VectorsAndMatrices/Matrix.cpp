@@ -8,6 +8,7 @@
 // 1 februari 1999	RD	Started
 // 2002-4-9 DD small changes
 // 2005-12-17 DD sameShape() function; ALSO size_t --> I
+// 2026-10-19 move constructor and assignment; structure built in place
 //
 // (C) Datasim Component Technology 1999-2006
 
@@ -31,11 +32,9 @@ Matrix<V, I, S>::Matrix()
 }
 
 template <class V, class I, class S>
-Matrix<V, I, S>::Matrix(I rows, I columns)
+Matrix<V, I, S>::Matrix(I rows, I columns): m_structure(rows, columns)
 { // Constructor with size. Start index=1.
 
-	m_structure=S(rows, columns);
-
 	m_rowstart=1;
 	m_columnstart=1;
 
@@ -43,11 +42,9 @@ Matrix<V, I, S>::Matrix(I rows, I columns)
 }
 
 template <class V, class I, class S>
-Matrix<V, I, S>::Matrix(I rows, I columns, I rowStart, I columnStart)
+Matrix<V, I, S>::Matrix(I rows, I columns, I rowStart, I columnStart): m_structure(rows, columns)
 { // Constructor with size & start index
 
-	m_structure=S(rows, columns);
-
 	m_rowstart=rowStart;
 	m_columnstart=columnStart;
 
@@ -66,6 +63,13 @@ Matrix<V, I, S>::Matrix(const Matrix<V, I, S>& source)
 	nr = source.nr; nc = source.nc;
 }
 
+template <class V, class I, class S>
+Matrix<V, I, S>::Matrix(Matrix<V, I, S>&& source) noexcept
+	: m_structure(std::move(source.m_structure)), m_rowstart(source.m_rowstart), m_columnstart(source.m_columnstart),
+	  nr(source.nr), nc(source.nc)
+{ // Move constructor
+}
+
 template <class V, class I, class S>
 Matrix<V, I, S>::~Matrix()
 { // Destructor
@@ -177,6 +181,22 @@ inline Matrix<V, I, S>& Matrix<V, I, S>::operator = (const Matrix<V, I, S>& sour
 	return *this;
 }
 
+template <class V, class I, class S>
+inline Matrix<V, I, S>& Matrix<V, I, S>::operator = (Matrix<V, I, S>&& source) noexcept
+{ // Move assignment
+
+	if (this==&source) return *this;
+
+	m_structure=std::move(source.m_structure);
+
+	m_rowstart=source.m_rowstart;
+	m_columnstart=source.m_columnstart;
+
+	nr = source.nr; nc = source.nc;
+
+	return *this;
+}
+
 
 
 #endif	// Matrix_cpp
@@ -11,9 +11,15 @@
 #define Matrix_hpp
 
 #include "UtilitiesDJD/VectorsAndMatrices/FullMatrix.cpp"
+#include "UtilitiesDJD/VectorsAndMatrices/RowMajorMatrix.cpp"
+#include "UtilitiesDJD/VectorsAndMatrices/BandedMatrix.cpp"
+#include "UtilitiesDJD/VectorsAndMatrices/CSRMatrix.cpp"
 #include "UtilitiesDJD/VectorsAndMatrices/Array.hpp"
 
 // Default structure is FullArray with default allocator. Default integral type is int.
+// RowMajorMatrix<V> gives contiguous storage with non-virtual element access.
+// BandedMatrix<V, KL, KU> (TridiagonalMatrix<V>, PentadiagonalMatrix<V>) and CSRMatrix<V>
+// store only the band or the non-zero entries.
 template <class V, class I=int, class S=FullMatrix<V> >
 class Matrix
 {
@@ -26,11 +32,15 @@ private:
 	I nr, nc;
 
 public:
+	typedef V value_type;
+	typedef I index_type;
+
 	// Constructors & destructor
 	Matrix();																			// Default constructor
 	Matrix(I rows, I columns);												// Constructor with size. Start index=0.
 	Matrix(I rows, I columns, I rowStart, I columnStart);		// Constructor with size & start index
 	Matrix(const Matrix<V, I, S>& source);						// Copy constructor
+	Matrix(Matrix<V, I, S>&& source) noexcept;					// Move constructor
 	virtual ~Matrix();																	// Destructor
 
 	// Selectors
@@ -42,6 +52,8 @@ public:
 	I Rows() const;					// The number of rows
 	I Columns() const;				// The number of columns
 
+	const S& Structure() const { return m_structure; }	// The storage structure
+
 
 	void Row(I row, const Array<V, I>& val);	// Replace row
 	void Column(I column, const Array<V, I>& val);	// Replace column
@@ -52,6 +64,7 @@ public:
 	V& operator () (I row, I column);				// Get the element at position
 
 	Matrix<V, I, S>& operator = (const Matrix<V, I, S>& source);
+	Matrix<V, I, S>& operator = (Matrix<V, I, S>&& source) noexcept;	// Move assignment
 };
 
 #endif	// Matrix_hpp
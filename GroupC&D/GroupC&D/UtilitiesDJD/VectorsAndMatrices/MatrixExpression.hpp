@@ -0,0 +1,231 @@
+// MatrixExpression.hpp
+//
+// Expression templates for elementwise NumericMatrix arithmetic: m1 + m2, m1 - m2,
+// -m, m * a, a * m and m / a with a scalar a. As for vectors (VectorExpression.hpp)
+// the operators build an expression that is evaluated in one pass on assignment
+// to a NumericMatrix. The matrix product m1 * m2 is not elementwise and still
+// returns a NumericMatrix.
+//
+// Matrices with RowMajorMatrix storage are read through a row pointer and stride;
+// other storage structures through operator ().
+//
+// 2026-10-19 kick-off
+//
+
+#ifndef MatrixExpression_hpp
+#define MatrixExpression_hpp
+
+#include <cstddef>
+#include <type_traits>
+#include "UtilitiesDJD/VectorsAndMatrices/VectorExpression.hpp"
+
+
+// Base class of all matrix expressions (CRTP). Indices of At() start at 0.
+template <class E>
+class MatrixExpression
+{
+public:
+	const E& Derived() const { return static_cast<const E&>(*this); }
+};
+
+
+// Leaf: any matrix, through its operator ()
+template <class M>
+class MatrixTerminal: public MatrixExpression<MatrixTerminal<M> >
+{
+private:
+	const M* m_matrix;
+
+public:
+	typedef typename M::value_type value_type;
+	typedef typename M::index_type index_type;
+
+	explicit MatrixTerminal(const M& m): m_matrix(&m) {}
+
+	value_type At(std::size_t i, std::size_t j) const
+	{
+		return (*m_matrix)(m_matrix->MinRowIndex() + index_type(i), m_matrix->MinColumnIndex() + index_type(j));
+	}
+
+	index_type Rows() const { return m_matrix->Rows(); }
+	index_type Columns() const { return m_matrix->Columns(); }
+	index_type MinRowIndex() const { return m_matrix->MinRowIndex(); }
+	index_type MinColumnIndex() const { return m_matrix->MinColumnIndex(); }
+};
+
+
+// Leaf: contiguous storage with a leading dimension
+template <class V, class I>
+class StridedMatrixTerminal: public MatrixExpression<StridedMatrixTerminal<V, I> >
+{
+private:
+	const V* m_data;
+	std::size_t m_stride;
+	I nr, nc;
+	I m_rowstart, m_columnstart;
+
+public:
+	typedef V value_type;
+	typedef I index_type;
+
+	StridedMatrixTerminal(const V* data, std::size_t stride, I rows, I columns, I rowStart, I columnStart)
+		: m_data(data), m_stride(stride), nr(rows), nc(columns), m_rowstart(rowStart), m_columnstart(columnStart) {}
+
+	value_type At(std::size_t i, std::size_t j) const { return m_data[i * m_stride + j]; }
+
+	index_type Rows() const { return nr; }
+	index_type Columns() const { return nc; }
+	index_type MinRowIndex() const { return m_rowstart; }
+	index_type MinColumnIndex() const { return m_columnstart; }
+};
+
+
+// l op r elementwise
+template <class L, class R, class Op>
+class MatrixBinary: public MatrixExpression<MatrixBinary<L, R, Op> >
+{
+private:
+	L m_left;
+	R m_right;
+
+public:
+	typedef typename L::value_type value_type;
+	typedef typename L::index_type index_type;
+
+	MatrixBinary(const L& l, const R& r): m_left(l), m_right(r) {}
+
+	value_type At(std::size_t i, std::size_t j) const { return Op::Apply(m_left.At(i, j), m_right.At(i, j)); }
+
+	index_type Rows() const { return m_left.Rows(); }
+	index_type Columns() const { return m_left.Columns(); }
+	index_type MinRowIndex() const { return m_left.MinRowIndex(); }
+	index_type MinColumnIndex() const { return m_left.MinColumnIndex(); }
+};
+
+
+// e op a (Left == false) or a op e (Left == true) with a scalar a
+template <class E, class Op, bool Left>
+class MatrixScalar: public MatrixExpression<MatrixScalar<E, Op, Left> >
+{
+public:
+	typedef typename E::value_type value_type;
+	typedef typename E::index_type index_type;
+
+private:
+	E m_expr;
+	value_type m_scalar;
+
+public:
+	MatrixScalar(const E& e, const value_type& a): m_expr(e), m_scalar(a) {}
+
+	value_type At(std::size_t i, std::size_t j) const
+	{
+		return Left ? Op::Apply(m_scalar, m_expr.At(i, j)) : Op::Apply(m_expr.At(i, j), m_scalar);
+	}
+
+	index_type Rows() const { return m_expr.Rows(); }
+	index_type Columns() const { return m_expr.Columns(); }
+	index_type MinRowIndex() const { return m_expr.MinRowIndex(); }
+	index_type MinColumnIndex() const { return m_expr.MinColumnIndex(); }
+};
+
+
+// op e
+template <class E, class Op>
+class MatrixUnary: public MatrixExpression<MatrixUnary<E, Op> >
+{
+private:
+	E m_expr;
+
+public:
+	typedef typename E::value_type value_type;
+	typedef typename E::index_type index_type;
+
+	explicit MatrixUnary(const E& e): m_expr(e) {}
+
+	value_type At(std::size_t i, std::size_t j) const { return Op::Apply(m_expr.At(i, j)); }
+
+	index_type Rows() const { return m_expr.Rows(); }
+	index_type Columns() const { return m_expr.Columns(); }
+	index_type MinRowIndex() const { return m_expr.MinRowIndex(); }
+	index_type MinColumnIndex() const { return m_expr.MinColumnIndex(); }
+};
+
+
+// Which types may appear in a matrix expression; NumericMatrix is added in NumericMatrix.hpp
+template <class T, class Enable = void>
+struct MatrixOperand
+{
+	static const bool value = false;
+};
+
+template <class E>
+struct MatrixOperand<E, typename std::enable_if<std::is_base_of<MatrixExpression<E>, E>::value>::type>
+{
+	static const bool value = true;
+
+	typedef E node_type;
+	typedef typename E::value_type value_type;
+
+	static const E& Node(const E& e) { return e; }
+};
+
+
+template <class L, class R>
+	typename std::enable_if<MatrixOperand<L>::value && MatrixOperand<R>::value,
+		MatrixBinary<typename MatrixOperand<L>::node_type, typename MatrixOperand<R>::node_type, ETPlus> >::type
+	operator + (const L& l, const R& r)
+{ // Add the elements
+
+	return MatrixBinary<typename MatrixOperand<L>::node_type, typename MatrixOperand<R>::node_type, ETPlus>
+		(MatrixOperand<L>::Node(l), MatrixOperand<R>::Node(r));
+}
+
+template <class L, class R>
+	typename std::enable_if<MatrixOperand<L>::value && MatrixOperand<R>::value,
+		MatrixBinary<typename MatrixOperand<L>::node_type, typename MatrixOperand<R>::node_type, ETMinus> >::type
+	operator - (const L& l, const R& r)
+{ // Subtract the elements
+
+	return MatrixBinary<typename MatrixOperand<L>::node_type, typename MatrixOperand<R>::node_type, ETMinus>
+		(MatrixOperand<L>::Node(l), MatrixOperand<R>::Node(r));
+}
+
+template <class E>
+	typename std::enable_if<MatrixOperand<E>::value,
+		MatrixUnary<typename MatrixOperand<E>::node_type, ETNegate> >::type
+	operator - (const E& e)
+{ // Unary minus
+
+	return MatrixUnary<typename MatrixOperand<E>::node_type, ETNegate>(MatrixOperand<E>::Node(e));
+}
+
+template <class L>
+	typename std::enable_if<MatrixOperand<L>::value,
+		MatrixScalar<typename MatrixOperand<L>::node_type, ETMultiplies, false> >::type
+	operator * (const L& l, const typename MatrixOperand<L>::value_type& a)
+{ // Multiply every element by a
+
+	return MatrixScalar<typename MatrixOperand<L>::node_type, ETMultiplies, false>(MatrixOperand<L>::Node(l), a);
+}
+
+template <class R>
+	typename std::enable_if<MatrixOperand<R>::value,
+		MatrixScalar<typename MatrixOperand<R>::node_type, ETMultiplies, true> >::type
+	operator * (const typename MatrixOperand<R>::value_type& a, const R& r)
+{ // Multiply every element by a
+
+	return MatrixScalar<typename MatrixOperand<R>::node_type, ETMultiplies, true>(MatrixOperand<R>::Node(r), a);
+}
+
+template <class L>
+	typename std::enable_if<MatrixOperand<L>::value,
+		MatrixScalar<typename MatrixOperand<L>::node_type, ETDivides, false> >::type
+	operator / (const L& l, const typename MatrixOperand<L>::value_type& a)
+{ // Divide every element by a
+
+	return MatrixScalar<typename MatrixOperand<L>::node_type, ETDivides, false>(MatrixOperand<L>::Node(l), a);
+}
+
+
+#endif	// MatrixExpression_hpp
@@ -0,0 +1,420 @@
+// MatrixKernels.cpp
+//
+// Blocked matrix-matrix and matrix-vector kernels.
+//
+// 2026-10-19 kick-off
+// 2026-10-19 persistent thread pool
+//
+
+#ifndef MatrixKernels_cpp
+#define MatrixKernels_cpp
+
+#include "UtilitiesDJD/VectorsAndMatrices/MatrixKernels.hpp"
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <algorithm>
+#include <atomic>
+
+
+inline std::atomic<unsigned>& matrixKernelThreadSetting()
+{
+	static std::atomic<unsigned> threads(0);
+	return threads;
+}
+
+inline void SetMatrixKernelThreads(unsigned threads)
+{
+	matrixKernelThreadSetting() = threads;
+}
+
+inline unsigned MatrixKernelThreads()
+{
+	unsigned threads = matrixKernelThreadSetting();
+	if (threads == 0) threads = std::thread::hardware_concurrency();
+
+	return (threads == 0) ? 1 : threads;
+}
+
+
+// Worker threads kept for the life of the program, so a product does not
+// start and join threads per panel. One job runs at a time; a caller that
+// finds the pool busy (another thread's product) runs its job itself.
+class MatrixKernelPool
+{
+private:
+	std::mutex jobLock;						// Held by the caller of the running job
+	std::mutex lock;
+	std::condition_variable wake, done;
+	std::vector<std::thread> workers;
+
+	void (*call)(const void* body, std::size_t part);
+	const void* body;
+	std::size_t parts;
+	std::atomic<std::size_t> next;
+	unsigned helpers;						// Workers taking part in the job
+	unsigned active;						// Of those, the ones not finished
+	unsigned long generation;				// Number of jobs started
+	bool stop;
+
+	template <class Body> static void Call(const void* body, std::size_t part)
+	{
+		(*static_cast<const Body*>(body))(part);
+	}
+
+	void Work()
+	{
+		for (std::size_t part = next++; part < parts; part = next++) call(body, part);
+	}
+
+	void Loop(unsigned index)
+	{
+		unsigned long seen = 0;
+		std::unique_lock<std::mutex> guard(lock);
+
+		for (;;)
+		{
+			wake.wait(guard, [&]() { return stop || generation != seen; });
+			if (stop) return;
+
+			seen = generation;
+			if (index >= helpers) continue;
+
+			guard.unlock();
+			Work();
+			guard.lock();
+
+			if (--active == 0) done.notify_one();
+		}
+	}
+
+	MatrixKernelPool() : call(0), body(0), parts(0), next(0), helpers(0), active(0), generation(0), stop(false)
+	{
+	}
+
+public:
+	~MatrixKernelPool()
+	{
+		{
+			std::lock_guard<std::mutex> guard(lock);
+			stop = true;
+		}
+		wake.notify_all();
+
+		for (std::size_t t = 0; t < workers.size(); ++t) workers[t].join();
+	}
+
+	static MatrixKernelPool& Instance()
+	{
+		static MatrixKernelPool pool;
+		return pool;
+	}
+
+	// body(part) for every part in [0, parts) on up to 'threads' threads,
+	// the calling thread included
+	template <class Body> void Run(std::size_t parts, unsigned threads, const Body& body)
+	{
+		if (threads > parts) threads = (unsigned) parts;
+
+		if (threads <= 1 || !jobLock.try_lock())
+		{
+			for (std::size_t part = 0; part < parts; ++part) body(part);
+			return;
+		}
+
+		std::lock_guard<std::mutex> job(jobLock, std::adopt_lock);
+
+		{
+			std::lock_guard<std::mutex> guard(lock);
+
+			while (workers.size() < threads - 1)
+			{
+				workers.push_back(std::thread(&MatrixKernelPool::Loop, this, unsigned(workers.size())));
+			}
+
+			this->call = &Call<Body>;
+			this->body = &body;
+			this->parts = parts;
+			next = 0;
+			helpers = active = threads - 1;
+			++generation;
+		}
+		wake.notify_all();
+
+		Work();
+
+		std::unique_lock<std::mutex> guard(lock);
+		done.wait(guard, [&]() { return active == 0; });
+	}
+};
+
+
+// Run body(first, last) on [0, size) split into chunks that are multiples of
+// 'granule', one per thread of the pool. The calling thread takes part too.
+template <class Body>
+	void parallelRange(std::size_t size, std::size_t granule, unsigned threads, const Body& body)
+{
+	std::size_t granules = (size + granule - 1) / granule;
+	if (threads > granules) threads = (unsigned) granules;
+
+	if (threads <= 1)
+	{
+		body(std::size_t(0), size);
+		return;
+	}
+
+	std::size_t chunk = ((granules + threads - 1) / threads) * granule;
+	std::size_t chunks = (size + chunk - 1) / chunk;
+
+	MatrixKernelPool::Instance().Run(chunks, threads, [&](std::size_t part)
+	{
+		body(part * chunk, std::min(size, (part + 1) * chunk));
+	});
+}
+
+
+// MR x NR register tile: c = sum over p of a[p] (column of MR) * b[p] (row of NR)
+template <class V>
+	inline void gemmMicroKernel(std::size_t kc, const V* a, const V* b, V* c)
+{
+	const std::size_t MR = GemmBlocking<V>::MR;
+	const std::size_t NR = GemmBlocking<V>::NR;
+
+	V acc[MR][NR];
+	for (std::size_t i = 0; i < MR; ++i)
+		for (std::size_t j = 0; j < NR; ++j) acc[i][j] = V(0.0);
+
+	for (std::size_t p = 0; p < kc; ++p)
+	{
+		const V* ap = a + p * MR;
+		const V* bp = b + p * NR;
+
+		for (std::size_t i = 0; i < MR; ++i)
+		{
+			V ai = ap[i];
+			for (std::size_t j = 0; j < NR; ++j) acc[i][j] += ai * bp[j];
+		}
+	}
+
+	for (std::size_t i = 0; i < MR; ++i)
+		for (std::size_t j = 0; j < NR; ++j) c[i * NR + j] = acc[i][j];
+}
+
+
+// Packing buffers of the blocked algorithm. They belong to the thread that
+// calls Gemm() and are kept between calls, so repeated products do not
+// allocate; the workers of one call share packB and use one packA block each.
+template <class V> struct GemmWorkspace
+{
+	std::vector<V> packA;		// parts x (MC x KC)
+	std::vector<V> packB;		// KC x NC
+
+	static GemmWorkspace& local()
+	{
+		static thread_local GemmWorkspace workspace;
+		return workspace;
+	}
+};
+
+
+// Pack B(pc:pc+kc, jc+first:jc+last) as NR wide row panels, zero padded;
+// first and last are multiples of NR or last == nc
+template <class V, class AccB>
+	void gemmPackB(std::size_t first, std::size_t last, std::size_t nc, std::size_t jc,
+				std::size_t pc, std::size_t kc, const AccB& B, V* packB)
+{
+	const std::size_t NR = GemmBlocking<V>::NR;
+
+	for (std::size_t jr = first; jr < last; jr += NR)
+	{
+		V* panel = packB + jr * kc;
+		for (std::size_t p = 0; p < kc; ++p)
+		{
+			for (std::size_t j = 0; j < NR; ++j)
+			{
+				panel[p * NR + j] = (jr + j < nc) ? B(pc + p, jc + jr + j) : V(0.0);
+			}
+		}
+	}
+}
+
+
+// Rows [first, last) of C += A(:, pc:pc+kc) * B(pc:pc+kc, jc:jc+nc), or = when
+// overwrite, with the B panel already in packB
+template <class V, class AccA, class AccC>
+	void gemmPanelRows(std::size_t first, std::size_t last, std::size_t jc, std::size_t nc,
+				std::size_t pc, std::size_t kc, const AccA& A, const V* packB, V* packA,
+				const AccC& C, bool overwrite)
+{
+	const std::size_t MR = GemmBlocking<V>::MR;
+	const std::size_t NR = GemmBlocking<V>::NR;
+	const std::size_t MC = GemmBlocking<V>::MC;
+
+	V tile[MR * NR];
+
+	for (std::size_t ic = first; ic < last; ic += MC)
+	{
+		std::size_t mc = std::min(MC, last - ic);
+
+		// Pack A(ic:ic+mc, pc:pc+kc) as MR high column panels, zero padded
+		for (std::size_t ir = 0; ir < mc; ir += MR)
+		{
+			V* panel = packA + ir * kc;
+			for (std::size_t i = 0; i < MR; ++i)
+			{
+				if (ir + i < mc)
+				{
+					for (std::size_t p = 0; p < kc; ++p) panel[p * MR + i] = A(ic + ir + i, pc + p);
+				}
+				else
+				{
+					for (std::size_t p = 0; p < kc; ++p) panel[p * MR + i] = V(0.0);
+				}
+			}
+		}
+
+		for (std::size_t jr = 0; jr < nc; jr += NR)
+		{
+			std::size_t nr = std::min(NR, nc - jr);
+
+			for (std::size_t ir = 0; ir < mc; ir += MR)
+			{
+				std::size_t mr = std::min(MR, mc - ir);
+
+				gemmMicroKernel<V>(kc, packA + ir * kc, packB + jr * kc, tile);
+
+				for (std::size_t i = 0; i < mr; ++i)
+				{
+					for (std::size_t j = 0; j < nr; ++j)
+					{
+						V& c = C(ic + ir + i, jc + jr + j);
+						c = overwrite ? tile[i * NR + j] : c + tile[i * NR + j];
+					}
+				}
+			}
+		}
+	}
+}
+
+
+template <class V, class AccA, class AccB, class AccC>
+	void Gemm(std::size_t m, std::size_t n, std::size_t k,
+				const AccA& A, const AccB& B, const AccC& C, bool accumulate)
+{
+	double flops = double(m) * double(n) * double(k);
+
+	if (k == 0)
+	{
+		if (!accumulate)
+		{
+			for (std::size_t i = 0; i < m; ++i)
+				for (std::size_t j = 0; j < n; ++j) C(i, j) = V(0.0);
+		}
+		return;
+	}
+
+	if (flops < GEMM_BLOCKED_FLOPS)
+	{ // i-k-j loop; the inner loop runs along rows of B and C
+
+		for (std::size_t i = 0; i < m; ++i)
+		{
+			if (!accumulate)
+			{
+				for (std::size_t j = 0; j < n; ++j) C(i, j) = V(0.0);
+			}
+
+			for (std::size_t p = 0; p < k; ++p)
+			{
+				V a = A(i, p);
+				for (std::size_t j = 0; j < n; ++j) C(i, j) += a * B(p, j);
+			}
+		}
+		return;
+	}
+
+	const std::size_t MR = GemmBlocking<V>::MR;
+	const std::size_t NR = GemmBlocking<V>::NR;
+	const std::size_t KC = GemmBlocking<V>::KC;
+	const std::size_t MC = GemmBlocking<V>::MC;
+	const std::size_t NC = GemmBlocking<V>::NC;
+
+	unsigned threads = (flops < GEMM_PARALLEL_FLOPS) ? 1 : MatrixKernelThreads();
+
+	// The rows of C in parts of whole register tiles, one part per thread
+	std::size_t tiles = (m + MR - 1) / MR;
+	if (threads > tiles) threads = (unsigned) tiles;
+	std::size_t partRows = ((tiles + threads - 1) / threads) * MR;
+	std::size_t parts = (m + partRows - 1) / partRows;
+
+	GemmWorkspace<V>& work = GemmWorkspace<V>::local();
+	if (work.packA.size() < parts * MC * KC) work.packA.resize(parts * MC * KC);
+	if (work.packB.size() < KC * NC) work.packB.resize(KC * NC);
+
+	V* packA = work.packA.data();
+	V* packB = work.packB.data();
+
+	for (std::size_t jc = 0; jc < n; jc += NC)
+	{
+		std::size_t nc = std::min(NC, n - jc);
+
+		for (std::size_t pc = 0; pc < k; pc += KC)
+		{
+			std::size_t kc = std::min(KC, k - pc);
+			bool overwrite = (pc == 0) && !accumulate;
+
+			// Each B panel is packed once and read by all threads
+			parallelRange(nc, NR, threads, [&](std::size_t first, std::size_t last)
+			{
+				gemmPackB<V>(first, last, nc, jc, pc, kc, B, packB);
+			});
+
+			parallelRange(parts, 1, threads, [&](std::size_t first, std::size_t last)
+			{
+				for (std::size_t part = first; part < last; ++part)
+				{
+					gemmPanelRows<V>(part * partRows, std::min(m, (part + 1) * partRows), jc, nc, pc, kc,
+										A, packB, packA + part * MC * KC, C, overwrite);
+				}
+			});
+		}
+	}
+}
+
+
+template <class V, class AccA>
+	void Gemv(std::size_t m, std::size_t n, const AccA& A, const V* x, V* y)
+{
+	unsigned threads = (double(m) * double(n) < GEMV_PARALLEL_SIZE) ? 1 : MatrixKernelThreads();
+
+	parallelRange(m, 4, threads, [&](std::size_t first, std::size_t last)
+	{
+		std::size_t i = first;
+
+		// Four rows at a time so that every x[j] is loaded once per four products
+		for (; i + 4 <= last; i += 4)
+		{
+			V y0(0.0), y1(0.0), y2(0.0), y3(0.0);
+			for (std::size_t j = 0; j < n; ++j)
+			{
+				V xj = x[j];
+				y0 += A(i, j) * xj;
+				y1 += A(i + 1, j) * xj;
+				y2 += A(i + 2, j) * xj;
+				y3 += A(i + 3, j) * xj;
+			}
+			y[i] = y0; y[i + 1] = y1; y[i + 2] = y2; y[i + 3] = y3;
+		}
+
+		for (; i < last; ++i)
+		{
+			V yi(0.0);
+			for (std::size_t j = 0; j < n; ++j) yi += A(i, j) * x[j];
+			y[i] = yi;
+		}
+	});
+}
+
+
+#endif	// MatrixKernels_cpp
@@ -0,0 +1,55 @@
+// MatrixKernels.hpp
+//
+// Blocked matrix-matrix and matrix-vector kernels used by NumericMatrix.
+//
+// The kernels do not depend on the matrix classes. Matrices are passed as
+// accessor objects with a zero-based operator () (i, j), so one kernel serves
+// all storage structures. For contiguous storage the accessors inline to
+// plain pointer arithmetic.
+//
+// GEMM follows the usual scheme: B is packed per KC x NC panel, A per
+// MC x KC block, and an MR x NR register tile is kept in local accumulators.
+// Each B panel is packed once and shared; the rows of C are split between
+// the threads of a pool that is started on first use and kept. The packing
+// buffers are kept by the calling thread for its next product. Small
+// problems use a plain loop with the i-k-j order.
+//
+// 2026-10-19 kick-off
+//
+
+#ifndef MatrixKernels_hpp
+#define MatrixKernels_hpp
+
+#include <cstddef>
+
+// Blocking parameters; MC and NC are multiples of MR and NR
+template <class V> struct GemmBlocking
+{
+	static const std::size_t MR = 4;		// Rows of a register tile
+	static const std::size_t NR = 8;		// Columns of a register tile
+	static const std::size_t KC = 256;		// Depth of a packed panel
+	static const std::size_t MC = 128;		// Rows of a packed block of A
+	static const std::size_t NC = 2048;		// Columns of a packed panel of B
+};
+
+// Problem sizes (m * n * k) from which the blocked kernel and threads are used
+const double GEMM_BLOCKED_FLOPS = 48.0 * 48.0 * 48.0;
+const double GEMM_PARALLEL_FLOPS = 160.0 * 160.0 * 160.0;
+const double GEMV_PARALLEL_SIZE = 512.0 * 512.0;
+
+// Number of threads the kernels may use; 0 means std::thread::hardware_concurrency()
+void SetMatrixKernelThreads(unsigned threads);
+unsigned MatrixKernelThreads();
+
+// C = A * B (accumulate == false) or C += A * B (accumulate == true)
+// with A m x k, B k x n and C m x n
+template <class V, class AccA, class AccB, class AccC>
+	void Gemm(std::size_t m, std::size_t n, std::size_t k,
+				const AccA& A, const AccB& B, const AccC& C, bool accumulate = false);
+
+// y = A * x with A m x n; x and y are contiguous arrays
+template <class V, class AccA>
+	void Gemv(std::size_t m, std::size_t n, const AccA& A, const V* x, V* y);
+
+
+#endif	// MatrixKernels_hpp
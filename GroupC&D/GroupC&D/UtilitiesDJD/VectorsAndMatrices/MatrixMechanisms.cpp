@@ -8,6 +8,7 @@
 //	DD 2004-4-9 Power method, code review and round-off
 //  DD 2005-12-1 Extracting a row fom a Matrix (can be optmised)
 //	DD 2006-8-6 set_diagonal() commented out
+//	2026-10-19 print() for any storage structure S
 //
 // (C) Datasim Education BV 2004-2012
 //
@@ -18,7 +19,7 @@
 
 #include "UtilitiesDJD/VectorsAndMatrices/MatrixMechanisms.hpp"
 ////////////// Useful and Basic Print Functions ////////////////////////////////////////////////////
-template <class V, class I> void print(const Matrix<V,I>& mat)
+template <class V, class I, class S> void print(const Matrix<V,I,S>& mat)
 {
 
 
@@ -15,6 +15,6 @@
 #include "UtilitiesDJD/VectorsAndMatrices/ArrayMechanisms.cpp"
 
 ////////////// Useful and Basic Print Functions ////////////////////////////////////////////////////
-template <class V, class I> void print(const Matrix<V,I>& v);
+template <class V, class I, class S> void print(const Matrix<V,I,S>& v);
 
 #endif
\ No newline at end of file
@@ -10,6 +10,12 @@
 // 2005-12-17 DD size_t -> I
 // 2006-8-10 DD fix a bug mat*mat
 // 2009-4-10 DD Transpose function; fix in mat*mat
+// 2026-10-19 mat*mat and mat*vec through the blocked kernels; Multiply() into an existing result
+// 2026-10-19 +, - and unary - are expression templates (MatrixExpression.hpp)
+// 2026-10-19 move constructors and assignment; operators reuse a temporary left operand
+// 2026-10-19 mat*vec and triangular solves through the kernels of banded and sparse storage
+// 2026-10-19 Multiply() raises an exception when the sizes do not match
+// 2026-10-19 mat*vec works on the vectors in place
 //
 // (C) Datasim Component Technology 1999-2006
 
@@ -45,6 +51,25 @@ NumericMatrix<V, I, S>::NumericMatrix(const NumericMatrix<V, I, S>& source): Mat
 { // Copy constructor
 }
 
+template <class V, class I, class S>
+NumericMatrix<V, I, S>::NumericMatrix(Matrix<V, I, S>&& source) noexcept: Matrix<V, I, S>(std::move(source))
+{ // Move from a matrix
+}
+
+template <class V, class I, class S>
+NumericMatrix<V, I, S>::NumericMatrix(NumericMatrix<V, I, S>&& source) noexcept: Matrix<V, I, S>(std::move(source))
+{ // Move constructor
+}
+
+template <class V, class I, class S>
+	template <class E>
+NumericMatrix<V, I, S>::NumericMatrix(const MatrixExpression<E>& expr)
+	: Matrix<V, I, S>(expr.Derived().Rows(), expr.Derived().Columns(), expr.Derived().MinRowIndex(), expr.Derived().MinColumnIndex())
+{ // Evaluate an expression
+
+	Assign(expr.Derived());
+}
+
 template <class V, class I, class S>
 NumericMatrix<V, I, S>::~NumericMatrix()
 { // Destructor
@@ -112,118 +137,222 @@ NumericMatrix<V, I, S>& NumericMatrix<V, I, S>::operator = (const NumericMatrix<
 }
 
 template <class V, class I, class S>
-NumericMatrix<V, I, S> NumericMatrix<V, I, S>::operator - () const
-{ // Unary minus
+NumericMatrix<V, I, S>& NumericMatrix<V, I, S>::operator = (NumericMatrix<V, I, S>&& source) noexcept
+{ // Move assignment
+
+	if (this==&source) return *this;
 
-	// Create new matrix with same size and same starting index
-	NumericMatrix<V, I, S> result(Rows(), Columns(), MinRowIndex(), MinColumnIndex());
+	Matrix<V, I, S>::operator = (std::move(source));
 
-	// Copy all elements negative
-	for (I r=MinRowIndex(); r<=MaxRowIndex(); r++)
+	return *this;
+}
+
+template <class V, class I, class S>
+	template <class E>
+void NumericMatrix<V, I, S>::Assign(const E& e)
+{ // One pass over the elements; e has the same shape as this matrix and
+  // element (i, j) of e only depends on elements (i, j) of its operands
+
+	std::size_t nr = std::size_t(Rows()), nc = std::size_t(Columns());
+	I r0 = MinRowIndex(), c0 = MinColumnIndex();
+
+	for (std::size_t i = 0; i < nr; ++i)
 	{
-		for (I c=MinColumnIndex(); c<=MaxColumnIndex(); c++) 
+		for (std::size_t j = 0; j < nc; ++j)
 		{
-
-			result(r,c) = -(*this)(r,c);
+			(*this)(r0 + I(i), c0 + I(j)) = e.At(i, j);
 		}
 	}
+}
+
+template <class V, class I, class S>
+	template <class E>
+NumericMatrix<V, I, S>& NumericMatrix<V, I, S>::operator = (const MatrixExpression<E>& expr)
+{ // Assignment of an expression
+
+	const E& e = expr.Derived();
+
+	if (Rows() != I(e.Rows()) || Columns() != I(e.Columns()))
+	{ // Different shape: evaluate into new storage before the old is released
+
+		NumericMatrix<V, I, S> tmp(expr);
+		Matrix<V, I, S>::operator = (tmp);
+		return *this;
+	}
+
+	Assign(e);
+
+	return *this;
+}
+
+template <class V, class I, class S>
+NumericMatrix<V, I, S> NumericMatrix<V, I, S>::operator * (const NumericMatrix<V, I, S>& m) const
+{ // Multiply the matrix.
+
+	// Create new matrix with same row size of first matrix and column size of second matrix and same starting index as first matrix
+	NumericMatrix<V, I, S> result(Rows(), m.Columns(), MinRowIndex(), MinColumnIndex());
+
+	Multiply(m, result);
 
 	// Return the result
 	return result;
 }
 
 
+template <class V, class I, class S> Vector<V, I> NumericMatrix<V, I, S>::operator * (const Vector<V, I>& v) const
+{
+
+	// Result has same number of rows as m and same start index as v
+	Vector<V, I> result(Rows(), v.MinIndex());
+
+	Multiply(v, result);
+
+	return result;
+}
 
 
 template <class V, class I, class S>
-NumericMatrix<V, I, S> NumericMatrix<V, I, S>::operator + (const NumericMatrix<V, I, S>& m) const
-{ // Add the elements
+void NumericMatrix<V, I, S>::Multiply(const NumericMatrix<V, I, S>& m, NumericMatrix<V, I, S>& result) const
+{ // result = (*this) * m. Element (r, c) is the inner product of row r of this matrix
+  // and column c of m, where column k of this matrix meets row k of m counting from
+  // their start indices.
 
-	
-	// Create new matrix with same size and same starting index
-	NumericMatrix<V, I, S> result(Rows(), Columns(), MinRowIndex(), MinColumnIndex());
+	if (Columns() != m.Rows())
+	{
+		throw DatasimException("Incompatible matrix sizes", "NumericMatrix::Multiply",
+								std::to_string(Rows()) + " x " + std::to_string(Columns()) + " times "
+								+ std::to_string(m.Rows()) + " x " + std::to_string(m.Columns()));
+	}
 
-	// Add all elements
-	for (I r1=MinRowIndex(); r1<=MaxRowIndex(); r1++)
+	// The kernel writes result while reading the inputs
+	if (&result == this || &result == &m)
 	{
-		for (I c1=MinColumnIndex(); c1<=MaxColumnIndex(); c1++) 
-			result(r1, c1) = (*this)(r1, c1) + m(r1, c1);
+		NumericMatrix<V, I, S> tmp(Rows(), m.Columns(), MinRowIndex(), MinColumnIndex());
+		Multiply(m, tmp);
+		result = tmp;
+		return;
+	}
 
+	if (result.Rows() != Rows() || result.Columns() != m.Columns())
+	{
+		result = NumericMatrix<V, I, S>(Rows(), m.Columns(), MinRowIndex(), MinColumnIndex());
 	}
 
-	// Return the result
-	return result;
+	// Zero-based accessors for the kernel
+	const NumericMatrix<V, I, S>& a = *this;
+	I ar = a.MinRowIndex(), ac = a.MinColumnIndex();
+	I br = m.MinRowIndex(), bc = m.MinColumnIndex();
+	I cr = result.MinRowIndex(), cc = result.MinColumnIndex();
+
+	auto A = [&a, ar, ac](std::size_t i, std::size_t j) -> const V& { return a(ar + I(i), ac + I(j)); };
+	auto B = [&m, br, bc](std::size_t i, std::size_t j) -> const V& { return m(br + I(i), bc + I(j)); };
+	auto C = [&result, cr, cc](std::size_t i, std::size_t j) -> V& { return result(cr + I(i), cc + I(j)); };
+
+	Gemm<V>(std::size_t(Rows()), std::size_t(m.Columns()), std::size_t(Columns()), A, B, C);
 }
 
+
 template <class V, class I, class S>
-NumericMatrix<V, I, S> NumericMatrix<V, I, S>::operator - (const NumericMatrix<V, I, S>& m) const
-{ // Subtract the elements
+void NumericMatrix<V, I, S>::Multiply(const Vector<V, I>& v, Vector<V, I>& result) const
+{ // result = (*this) * v; column j of this matrix meets element j of v counting from their start indices
 
-	// Create new matrix with same size and same starting index
-	NumericMatrix<V, I, S> result(Rows(), Columns(), MinRowIndex(), MinColumnIndex());
-	print(result);
+	if (Columns() != v.Size())
+	{
+		throw DatasimException("Incompatible matrix and vector sizes", "NumericMatrix::Multiply",
+								std::to_string(Rows()) + " x " + std::to_string(Columns()) + " times "
+								+ std::to_string(v.Size()));
+	}
 
-	// Add all elements
-	for (I r1 = MinRowIndex(); r1<=MaxRowIndex(); r1++)
+	// The kernels write result while reading v
+	if (&result == &v)
 	{
-		for (I c1=MinColumnIndex(); c1<=MaxColumnIndex(); c1++)
-			result(r1, c1) = (*this)(r1, c1) - m(r1, c1);
+		Vector<V, I> tmp(Rows(), v.MinIndex());
+		Multiply(v, tmp);
+		result = std::move(tmp);
+		return;
 	}
 
-	// Return the result
-	return result;
+	if (result.Size() != Rows())
+	{
+		result = Vector<V, I>(Rows(), v.MinIndex());
+	}
+
+	// Both vectors are contiguous, so the kernels work on them in place
+	const V* x = v.Data();
+	V* y = result.Data();
+
+	if constexpr (HasStructureKernels<S, V>::value)
+	{ // Banded and sparse storage visit only the stored entries
+
+		this->Structure().Multiply(x, y);
+	}
+	else
+	{
+		const NumericMatrix<V, I, S>& a = *this;
+		I ar = a.MinRowIndex(), ac = a.MinColumnIndex();
+		auto A = [&a, ar, ac](std::size_t i, std::size_t j) -> const V& { return a(ar + I(i), ac + I(j)); };
+
+		Gemv<V>(std::size_t(Rows()), std::size_t(Columns()), A, x, y);
+	}
 }
 
 template <class V, class I, class S>
-NumericMatrix<V, I, S> NumericMatrix<V, I, S>::operator * (const NumericMatrix<V, I, S>& m) const
-{ // Multiply the matrix.
-  // This function can be optimized by calculating the inner product ourselfs instead of 
-  // using the InnerProduct function of Vector. This saves a couple of row and column copies.
+Vector<V, I> NumericMatrix<V, I, S>::SolveLower(const Vector<V, I>& b, bool unitDiagonal) const
+{ // Forward substitution with the lower triangle; the result has the index range of b
 
+	std::vector<V> x(b.Size());
+	for (std::size_t i = 0; i < x.size(); ++i) x[i] = b[b.MinIndex() + I(i)];
 
-	// Create new matrix with same row size of first matrix and column size of second matrix and same starting index as first matrix
-	NumericMatrix<V, I, S> result(Rows(), m.Columns(), MinRowIndex(), MinColumnIndex());
-	I r1, c2, rr, cr;
-
-	// Element of resulting array is dot/inner product of corresponding row m1 and corresponding column m2
-	for (I rr=result.MinRowIndex(); rr<=result.MaxRowIndex(); ++rr)
+	if constexpr (HasStructureKernels<S, V>::value)
 	{
-		
-		for (I cr = result.MinColumnIndex(); cr <= result.MaxColumnIndex(); ++cr) 
-		{
-			result(rr, cr) = 0.0;
-			for (I k = result.MinColumnIndex(); k <= result.MaxColumnIndex(); ++k)
-			{
+		if (!x.empty()) this->Structure().SolveLower(&x[0], &x[0], unitDiagonal);
+	}
+	else
+	{
+		const NumericMatrix<V, I, S>& a = *this;
+		I ar = a.MinRowIndex(), ac = a.MinColumnIndex();
 
-					result(rr, cr) += (*this)(rr, k) * m(k,cr);
-			}
-			cout << "*" << rr << "," << cr << "," << result(rr, cr)<< endl;
+		for (std::size_t i = 0; i < x.size(); ++i)
+		{
+			V sum = x[i];
+			for (std::size_t j = 0; j < i; ++j) sum -= a(ar + I(i), ac + I(j)) * x[j];
+			x[i] = unitDiagonal ? sum : sum / a(ar + I(i), ac + I(i));
 		}
-			
 	}
 
-	// Return the result
+	Vector<V, I> result(b.Size(), b.MinIndex());
+	for (std::size_t i = 0; i < x.size(); ++i) result[b.MinIndex() + I(i)] = x[i];
+
 	return result;
 }
 
+template <class V, class I, class S>
+Vector<V, I> NumericMatrix<V, I, S>::SolveUpper(const Vector<V, I>& b, bool unitDiagonal) const
+{ // Back substitution with the upper triangle; the result has the index range of b
 
-template <class V, class I, class S> Vector<V, I> NumericMatrix<V, I, S>::operator * (const Vector<V, I>& v) const
-{
-
-	// Result has same number of rows as m and same start index as v
-	Vector<V, I> result(Rows(), v.MinIndex());
+	std::vector<V> x(b.Size());
+	for (std::size_t i = 0; i < x.size(); ++i) x[i] = b[b.MinIndex() + I(i)];
 
-	V r(0.0);	// sum of rows
-	for (I i = MinRowIndex(); i <= MaxRowIndex(); i++)
+	if constexpr (HasStructureKernels<S, V>::value)
 	{
-		r = 0.0;
-		for (I j = MinColumnIndex(); j<= MaxColumnIndex(); j++)
+		if (!x.empty()) this->Structure().SolveUpper(&x[0], &x[0], unitDiagonal);
+	}
+	else
+	{
+		const NumericMatrix<V, I, S>& a = *this;
+		I ar = a.MinRowIndex(), ac = a.MinColumnIndex();
+
+		for (std::size_t i = x.size(); i-- > 0; )
 		{
-				r += (*this)(i,j) * v[j];
+			V sum = x[i];
+			for (std::size_t j = i + 1; j < x.size(); ++j) sum -= a(ar + I(i), ac + I(j)) * x[j];
+			x[i] = unitDiagonal ? sum : sum / a(ar + I(i), ac + I(i));
 		}
-		result[i] = r;
 	}
 
+	Vector<V, I> result(b.Size(), b.MinIndex());
+	for (std::size_t i = 0; i < x.size(); ++i) result[b.MinIndex() + I(i)] = x[i];
+
 	return result;
 }
 
@@ -246,4 +375,61 @@ template <class V, class I, class S>  NumericMatrix<V, I, S> NumericMatrix<V, I,
 
 
 
+template <class V, class I, class S, class R>
+	typename std::enable_if<MatrixOperand<R>::value, NumericMatrix<V, I, S> >::type
+	operator + (NumericMatrix<V, I, S>&& l, const R& r)
+{ // Add the elements; the result is written into l
+
+	l = MatrixOperand<NumericMatrix<V, I, S> >::Node(l) + MatrixOperand<R>::Node(r);
+
+	return std::move(l);
+}
+
+template <class V, class I, class S, class R>
+	typename std::enable_if<MatrixOperand<R>::value, NumericMatrix<V, I, S> >::type
+	operator - (NumericMatrix<V, I, S>&& l, const R& r)
+{ // Subtract the elements; the result is written into l
+
+	l = MatrixOperand<NumericMatrix<V, I, S> >::Node(l) - MatrixOperand<R>::Node(r);
+
+	return std::move(l);
+}
+
+template <class V, class I, class S>
+	NumericMatrix<V, I, S> operator * (NumericMatrix<V, I, S>&& l, const typename MatrixOperand<NumericMatrix<V, I, S> >::value_type& a)
+{ // Multiply every element by a; the result is written into l
+
+	l = MatrixOperand<NumericMatrix<V, I, S> >::Node(l) * a;
+
+	return std::move(l);
+}
+
+template <class V, class I, class S>
+	NumericMatrix<V, I, S> operator * (const typename MatrixOperand<NumericMatrix<V, I, S> >::value_type& a, NumericMatrix<V, I, S>&& r)
+{ // Multiply every element by a; the result is written into r
+
+	r = a * MatrixOperand<NumericMatrix<V, I, S> >::Node(r);
+
+	return std::move(r);
+}
+
+template <class V, class I, class S>
+	NumericMatrix<V, I, S> operator / (NumericMatrix<V, I, S>&& l, const typename MatrixOperand<NumericMatrix<V, I, S> >::value_type& a)
+{ // Divide every element by a; the result is written into l
+
+	l = MatrixOperand<NumericMatrix<V, I, S> >::Node(l) / a;
+
+	return std::move(l);
+}
+
+template <class V, class I, class S>
+	NumericMatrix<V, I, S> operator - (NumericMatrix<V, I, S>&& m)
+{ // Unary minus; the result is written into m
+
+	m = -MatrixOperand<NumericMatrix<V, I, S> >::Node(m);
+
+	return std::move(m);
+}
+
+
 #endif	// NumericMatrix_cpp
\ No newline at end of file
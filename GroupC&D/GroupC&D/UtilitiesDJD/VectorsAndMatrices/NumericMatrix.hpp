@@ -11,13 +11,32 @@
 
 #include "UtilitiesDJD/VectorsAndMatrices/Matrix.cpp"
 #include "UtilitiesDJD/VectorsAndMatrices/Vector.cpp"
+#include "UtilitiesDJD/VectorsAndMatrices/MatrixKernels.cpp"
+#include "UtilitiesDJD/VectorsAndMatrices/MatrixExpression.hpp"
+#include "UtilitiesDJD/ExceptionClasses/DatasimException.hpp"
+#include <string>
 
 
+// Storage classes with their own kernels Multiply(x, y), SolveLower(b, x, unit) and
+// SolveUpper(b, x, unit) on zero-based arrays (BandedMatrix, CSRMatrix)
+template <class S, class V>
+struct HasStructureKernels
+{
+	static const bool value = requires(const S& s, const V* b, V* x)
+	{
+		s.Multiply(b, x);
+		s.SolveLower(b, x, true);
+		s.SolveUpper(b, x, true);
+	};
+};
+
 // Default structure is FullArray with default allocator. Default integral type is int.
+// Elementwise arithmetic uses the expression templates in MatrixExpression.hpp.
 template <class V, class I=int, class S=FullMatrix<V> >
 class NumericMatrix: public Matrix<V, I, S>
 {
 private:
+	template <class E> void Assign(const E& e);		// Evaluate e into this matrix
 
 public:
 	// Constructors & destructor
@@ -26,6 +45,10 @@ public:
 	NumericMatrix(I rows, I columns, I rowStart, I columnStart);		// Constructor with size & start index
 	NumericMatrix(const Matrix<V, I, S>& source);			// Constructor with matrix
 	NumericMatrix(const NumericMatrix<V, I, S>& source);	// Copy constructor
+	NumericMatrix(Matrix<V, I, S>&& source) noexcept;			// Move from a matrix
+	NumericMatrix(NumericMatrix<V, I, S>&& source) noexcept;	// Move constructor
+	template <class E>
+		NumericMatrix(const MatrixExpression<E>& expr);		// Evaluate an expression
 	virtual ~NumericMatrix();							// Destructor
 
 	// Selectors
@@ -39,18 +62,70 @@ public:
 
 	// Operators
 	NumericMatrix<V, I, S>& operator = (const NumericMatrix<V, I, S>& source);
+	NumericMatrix<V, I, S>& operator = (NumericMatrix<V, I, S>&& source) noexcept;	// Move assignment
 
-	NumericMatrix<V, I, S> operator - () const;			// Unary minus
+	template <class E>
+		NumericMatrix<V, I, S>& operator = (const MatrixExpression<E>& expr);		// One pass, no temporaries
 
-	
-	NumericMatrix<V, I, S> operator + (const NumericMatrix<V, I, S>& m) const;		// Add the elements
-	NumericMatrix<V, I, S> operator - (const NumericMatrix<V, I, S>& m) const;		// Subtract the elements
 	NumericMatrix<V, I, S> operator * (const NumericMatrix<V, I, S>& m) const;		// Multiply the matrices
 	Vector<V, I> operator * (const Vector<V, I>& v) const;
 
 	NumericMatrix<V, I, S> Transpose() const;										// Switch rows and columns
 
+	// Multiply into an existing result; result is resized only if its shape is wrong.
+	// Operands whose sizes do not match raise a DatasimException.
+	// Large products use the blocked (and multithreaded) kernels in MatrixKernels.
+	void Multiply(const NumericMatrix<V, I, S>& m, NumericMatrix<V, I, S>& result) const;	// result = (*this) * m
+	void Multiply(const Vector<V, I>& v, Vector<V, I>& result) const;					// result = (*this) * v
+
+	// Solve with the lower/upper triangle of a square matrix. Banded and sparse storage
+	// use their own kernels, so the cost is proportional to the stored entries.
+	Vector<V, I> SolveLower(const Vector<V, I>& b, bool unitDiagonal = false) const;
+	Vector<V, I> SolveUpper(const Vector<V, I>& b, bool unitDiagonal = false) const;
+
 
 };
 
+// Numeric matrices are leaves of matrix expressions
+template <class V, class I, class S>
+struct MatrixOperand<NumericMatrix<V, I, S>, void>
+{
+	static const bool value = true;
+
+	typedef MatrixTerminal<NumericMatrix<V, I, S> > node_type;
+	typedef V value_type;
+
+	static node_type Node(const NumericMatrix<V, I, S>& m) { return node_type(m); }
+};
+
+template <class V, class I, class TA>
+struct MatrixOperand<NumericMatrix<V, I, RowMajorMatrix<V, TA> >, void>
+{
+	static const bool value = true;
+
+	typedef StridedMatrixTerminal<V, I> node_type;
+	typedef V value_type;
+
+	static node_type Node(const NumericMatrix<V, I, RowMajorMatrix<V, TA> >& m)
+	{
+		return node_type(m.Structure().Data(), m.Structure().Stride(), m.Rows(), m.Columns(), m.MinRowIndex(), m.MinColumnIndex());
+	}
+};
+
+// A temporary left operand is reused for the result
+template <class V, class I, class S, class R>
+	typename std::enable_if<MatrixOperand<R>::value, NumericMatrix<V, I, S> >::type
+	operator + (NumericMatrix<V, I, S>&& l, const R& r);
+template <class V, class I, class S, class R>
+	typename std::enable_if<MatrixOperand<R>::value, NumericMatrix<V, I, S> >::type
+	operator - (NumericMatrix<V, I, S>&& l, const R& r);
+template <class V, class I, class S>
+	NumericMatrix<V, I, S> operator * (NumericMatrix<V, I, S>&& l, const typename MatrixOperand<NumericMatrix<V, I, S> >::value_type& a);
+template <class V, class I, class S>
+	NumericMatrix<V, I, S> operator * (const typename MatrixOperand<NumericMatrix<V, I, S> >::value_type& a, NumericMatrix<V, I, S>&& r);
+template <class V, class I, class S>
+	NumericMatrix<V, I, S> operator / (NumericMatrix<V, I, S>&& l, const typename MatrixOperand<NumericMatrix<V, I, S> >::value_type& a);
+template <class V, class I, class S>
+	NumericMatrix<V, I, S> operator - (NumericMatrix<V, I, S>&& m);		// Unary minus
+
 #endif
\ No newline at end of file
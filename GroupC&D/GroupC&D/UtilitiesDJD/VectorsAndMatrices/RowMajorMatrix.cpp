@@ -0,0 +1,91 @@
+// RowMajorMatrix.cpp
+//
+// Contiguous row-major matrix storage.
+//
+// 2026-10-19 kick-off
+// 2026-10-19 move constructor and assignment
+// 2026-10-19 destructor not virtual
+
+#ifndef RowMajorMatrix_cpp
+#define RowMajorMatrix_cpp
+
+#include "UtilitiesDJD/VectorsAndMatrices/RowMajorMatrix.hpp"
+
+
+template <class V, class TA>
+size_t RowMajorMatrix<V, TA>::LeadingDimension(size_t columns)
+{ // Round the row length up to a whole number of cache lines when the
+  // element size allows it; otherwise rows are packed
+
+	const size_t line = 64;
+	if (sizeof(V) >= line || line % sizeof(V) != 0) return columns;
+
+	size_t perLine = line / sizeof(V);
+	return ((columns + perLine - 1) / perLine) * perLine;
+}
+
+// Constructors & destructor
+template <class V, class TA>
+RowMajorMatrix<V, TA>::RowMajorMatrix()
+{ // Default constructor
+
+	nr = nc = 1;
+	ld = LeadingDimension(nc);
+
+	m_data = std::vector<V, TA>(ld);
+}
+
+template <class V, class TA>
+RowMajorMatrix<V, TA>::RowMajorMatrix(size_t rows, size_t columns)
+	: m_data(rows * LeadingDimension(columns)), nr(rows), nc(columns), ld(LeadingDimension(columns))
+{ // Constructor with size
+}
+
+template <class V, class TA>
+RowMajorMatrix<V, TA>::RowMajorMatrix(const RowMajorMatrix<V, TA>& source)
+	: m_data(source.m_data), nr(source.nr), nc(source.nc), ld(source.ld)
+{ // Copy constructor
+}
+
+template <class V, class TA>
+RowMajorMatrix<V, TA>::RowMajorMatrix(RowMajorMatrix<V, TA>&& source) noexcept
+	: m_data(std::move(source.m_data)), nr(source.nr), nc(source.nc), ld(source.ld)
+{ // Move constructor
+}
+
+template <class V, class TA>
+RowMajorMatrix<V, TA>::~RowMajorMatrix()
+{ // Destructor
+}
+
+// Operators
+template <class V, class TA>
+RowMajorMatrix<V, TA>& RowMajorMatrix<V, TA>::operator = (const RowMajorMatrix<V, TA>& source)
+{ // Assignment operator
+
+	// Exit if same object
+	if (this==&source) return *this;
+
+	m_data = source.m_data;
+
+	nr = source.nr; nc = source.nc; ld = source.ld;
+
+	return *this;
+}
+
+
+template <class V, class TA>
+RowMajorMatrix<V, TA>& RowMajorMatrix<V, TA>::operator = (RowMajorMatrix<V, TA>&& source) noexcept
+{ // Move assignment
+
+	if (this==&source) return *this;
+
+	m_data = std::move(source.m_data);
+
+	nr = source.nr; nc = source.nc; ld = source.ld;
+
+	return *this;
+}
+
+
+#endif	// RowMajorMatrix_cpp
@@ -0,0 +1,113 @@
+// RowMajorMatrix.hpp
+//
+// Contiguous matrix storage for use as the S argument of Matrix and NumericMatrix.
+// All elements live in one aligned buffer, row after row. Each row is padded to
+// the leading dimension so that every row starts on a cache line.
+//
+// Indexing starts at 1, as in FullMatrix. operator [] returns a small row handle
+// by value instead of an ArrayStructure reference, so m(i, j) in Matrix has no
+// virtual calls and reduces to a single load from data + (i-1)*ld + (j-1).
+
+#ifndef RowMajorMatrix_hpp
+#define RowMajorMatrix_hpp
+
+#include <vector>
+#include <cstddef>
+#include "UtilitiesDJD/VectorsAndMatrices/AlignedAllocator.hpp"
+
+
+template <class TValue, class TA=AlignedAllocator<TValue> >
+class RowMajorMatrix
+{
+public:
+	// Handle to one row; indexing starts at 1
+	class RowReference
+	{
+	private:
+		TValue* m_row;
+
+	public:
+		explicit RowReference(TValue* row): m_row(row) {}
+
+		TValue& operator[] (size_t column) const { return m_row[column - 1]; }
+		TValue* Data() const { return m_row; }
+	};
+
+	class ConstRowReference
+	{
+	private:
+		const TValue* m_row;
+
+	public:
+		explicit ConstRowReference(const TValue* row): m_row(row) {}
+
+		const TValue& operator[] (size_t column) const { return m_row[column - 1]; }
+		const TValue* Data() const { return m_row; }
+	};
+
+private:
+	std::vector<TValue, TA> m_data;
+
+	size_t nr, nc;
+	size_t ld;		// Leading dimension (distance between rows) >= nc
+
+	static size_t LeadingDimension(size_t columns);
+
+public:
+	// Constructors & destructor
+	RowMajorMatrix();											// Default constructor (1 X 1)
+	RowMajorMatrix(size_t rows, size_t columns);				// Constructor with size
+	RowMajorMatrix(const RowMajorMatrix<TValue, TA>& source);	// Copy constructor
+	RowMajorMatrix(RowMajorMatrix<TValue, TA>&& source) noexcept;	// Move constructor
+	~RowMajorMatrix();											// Destructor
+
+	// Selectors
+	size_t Rows() const { return nr; }							// Number of rows
+	size_t Columns() const { return nc; }						// Number of columns
+	size_t Stride() const { return ld; }						// Leading dimension
+
+	size_t MinRowIndex() const { return 1; }
+	size_t MaxRowIndex() const { return nr; }
+	size_t MinColumnIndex() const { return 1; }
+	size_t MaxColumnIndex() const { return nc; }
+
+	const TValue& Element(size_t row, size_t column) const { return (*this)(row, column); }
+
+	// Raw access to the buffer; element (i, j) is at Data()[(i-1)*Stride() + (j-1)]
+	TValue* Data() { return m_data.data(); }
+	const TValue* Data() const { return m_data.data(); }
+
+	// Modifiers
+	void Element(size_t row, size_t column, const TValue& val) { (*this)(row, column) = val; }
+
+	// Operators
+	RowReference operator[] (size_t row)
+	{ // Subscripting operator
+
+		return RowReference(m_data.data() + (row - 1) * ld);
+	}
+
+	ConstRowReference operator[] (size_t row) const
+	{ // Subscripting operator
+
+		return ConstRowReference(m_data.data() + (row - 1) * ld);
+	}
+
+	TValue& operator () (size_t row, size_t column)
+	{ // Get the element at position
+
+		return m_data[(row - 1) * ld + (column - 1)];
+	}
+
+	const TValue& operator () (size_t row, size_t column) const
+	{ // Get the element at position
+
+		return m_data[(row - 1) * ld + (column - 1)];
+	}
+
+	RowMajorMatrix<TValue, TA>& operator = (const RowMajorMatrix<TValue, TA>& source);
+	RowMajorMatrix<TValue, TA>& operator = (RowMajorMatrix<TValue, TA>&& source) noexcept;
+};
+
+
+#endif	// RowMajorMatrix_hpp
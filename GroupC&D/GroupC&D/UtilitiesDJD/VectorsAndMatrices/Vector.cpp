@@ -11,6 +11,9 @@
 // 2006-2-2 DD all friend members (e.g. operators) must have the template 
 // specification otherwise it is not correct C++.
 // 2007-12-20 Extra bracket ')' removed that caused a compiler error
+// 2026-10-19 arithmetic operators are expression templates (VectorExpression.hpp);
+// a compound expression is evaluated in one loop without temporaries
+// 2026-10-19 move constructor and assignment; operators reuse a temporary left operand
 /*
 template <class V, class I, class S>
 Vector<V, I, S> Vector<V, I, S>::operator - () const
@@ -71,6 +74,16 @@ Vector<V, I, S>::Vector(const Array<V, I, S>& source): Array<V, I, S>(source)
 { // Constructor with a Array
 }
 
+template <class V, class I, class S>
+Vector<V, I, S>::Vector(Vector<V, I, S>&& source) noexcept: Array<V, I, S>(std::move(source))
+{ // Move constructor
+}
+
+template <class V, class I, class S>
+Vector<V, I, S>::Vector(Array<V, I, S>&& source) noexcept: Array<V, I, S>(std::move(source))
+{ // Move from an array
+}
+
 template <class V, class I, class S>
 Vector<V, I, S>::~Vector()
 { // Destructor
@@ -93,139 +106,199 @@ Vector<V, I, S>& Vector<V, I, S>::operator = (const Vector<V, I, S>& source)
 }
 
 template <class V, class I, class S>
-Vector<V, I, S> Vector<V, I, S>::operator - () const
-{ // Unary minus
+Vector<V, I, S>& Vector<V, I, S>::operator = (Vector<V, I, S>&& source) noexcept
+{ // Move assignment
 
-	// Create new vector of same size and same starting index
-	Vector<V, I, S> result(Size(), MinIndex());
+	if (this==&source) return *this;
 
-	// Copy all elements negative
-	for (I i=MinIndex(); i<=MaxIndex(); i++) 
-	/// BUG BUG DAMN IT	result[i] = - result[i];
-	result[i] = - (*this)[i];
+	Array<V, I, S>::operator = (std::move(source));
 
-	// Return result
-	return result;
+	return *this;
 }
 
 template <class V, class I, class S>
-Vector<V, I, S> operator + (const Vector<V, I, S>& v, const V& a)
-{ // Add v to every element
+	template <class E>
+Vector<V, I, S>::Vector(const VectorExpression<E>& expr)
+	: Array<V, I, S>(expr.Derived().Size(), expr.Derived().MinIndex())
+{ // Evaluate an expression
 
-	// Create new vector of same size and same starting index
-	Vector<V, I, S> result(v.Size(), v.MinIndex());
+	Assign(expr.Derived());
+}
 
-	// Copy all elements + v
-	for (I i = v.MinIndex(); i <= v.MaxIndex(); i++) 
-		result[i] = v[i] + a;
+template <class V, class I, class S>
+	template <class E>
+void Vector<V, I, S>::Assign(const E& e)
+{ // One loop over contiguous memory; e has the same size as this vector.
+  // Every element of e only depends on the elements at the same position,
+  // so e may refer to this vector itself.
 
-	// Return result
-	return result;
-}
+	V* result = Data();
+	std::size_t n = std::size_t(Size());
 
+	for (std::size_t k = 0; k < n; ++k) result[k] = e.At(k);
+}
 
 template <class V, class I, class S>
-Vector<V, I, S> operator + (const V& a, const Vector<V, I, S>& v)
-{
-	return v + a;
+	template <class E>
+Vector<V, I, S>& Vector<V, I, S>::operator = (const VectorExpression<E>& expr)
+{ // Assignment of an expression
+
+	const E& e = expr.Derived();
+
+	if (Size() != I(e.Size()))
+	{ // Different size: evaluate into new storage before the old is released
+
+		Vector<V, I, S> tmp(expr);
+		Array<V, I, S>::operator = (tmp);
+		return *this;
+	}
+
+	Assign(e);
+
+	return *this;
 }
 
 template <class V, class I, class S>
-Vector<V, I, S> operator * (const Vector<V, I, S>& v, const V& a)
-{ // Multiply to every element by a
+	template <class E>
+Vector<V, I, S>& Vector<V, I, S>::operator += (const VectorExpression<E>& expr)
+{ // Add the elements
 
-	// Create new vector of same size and same starting index
-	Vector<V, I, S> result(v.Size(), v.MinIndex());
+	Assign(VectorOperand<Vector<V, I, S> >::Node(*this) + expr.Derived());
+
+	return *this;
+}
+
+template <class V, class I, class S>
+	template <class E>
+Vector<V, I, S>& Vector<V, I, S>::operator -= (const VectorExpression<E>& expr)
+{ // Subtract the elements
 
-	// Copy all elements + v
-	for (I i = v.MinIndex(); i <= v.MaxIndex(); i++) 
-		result[i] = v[i] * a;
+	Assign(VectorOperand<Vector<V, I, S> >::Node(*this) - expr.Derived());
 
-	// Return result
-	return result;
+	return *this;
 }
 
 template <class V, class I, class S>
-Vector<V, I, S> operator * (const V& a, const Vector<V, I, S>& v)
-{
-	return v * a;
+	template <class E>
+Vector<V, I, S>& Vector<V, I, S>::operator *= (const VectorExpression<E>& expr)
+{ // Multiply the elements
+
+	Assign(VectorOperand<Vector<V, I, S> >::Node(*this) * expr.Derived());
+
+	return *this;
 }
 
 
-template <class V, class I, class S>
-Vector<V, I, S> operator - (const Vector<V, I, S>& v, const V& a)
-{ // Subtract v from every element
+template <class V, class I, class S, class R>
+	typename std::enable_if<VectorOperand<R>::value, Vector<V, I, S> >::type
+	operator + (Vector<V, I, S>&& l, const R& r)
+{ // Add the elements; the result is written into l
 
-	// Create new vector of same size and same starting index
-	Vector<V, I, S> result(v.Size(), v.MinIndex());
+	l = VectorOperand<Vector<V, I, S> >::Node(l) + VectorOperand<R>::Node(r);
+
+	return std::move(l);
+}
 
-	// Copy all elements - v
-	for (I i = v.MinIndex(); i <= v.MaxIndex(); i++) 
-		result[i] = v[i] - a;
+template <class V, class I, class S, class R>
+	typename std::enable_if<VectorOperand<R>::value, Vector<V, I, S> >::type
+	operator - (Vector<V, I, S>&& l, const R& r)
+{ // Subtract the elements; the result is written into l
 
-	// Return result
-	return result;
+	l = VectorOperand<Vector<V, I, S> >::Node(l) - VectorOperand<R>::Node(r);
+
+	return std::move(l);
 }
 
-template <class V, class I, class S>
-Vector<V, I, S> operator - (const V& a, const Vector<V, I, S>& v)
-{
-	// Create new vector of same size and same starting index
-	Vector<V, I, S> result(v.Size(), v.MinIndex());
+template <class V, class I, class S, class R>
+	typename std::enable_if<VectorOperand<R>::value, Vector<V, I, S> >::type
+	operator * (Vector<V, I, S>&& l, const R& r)
+{ // Multiply the elements; the result is written into l
 
-	// Copy all elements - v
-	for (I i = v.MinIndex(); i <= v.MaxIndex(); i++) 
-		result[i] = a - v[i];
+	l = VectorOperand<Vector<V, I, S> >::Node(l) * VectorOperand<R>::Node(r);
 
-	// Return result
-	return result;
+	return std::move(l);
+}
 
+template <class V, class I, class S, class R>
+	typename std::enable_if<VectorOperand<R>::value, Vector<V, I, S> >::type
+	operator / (Vector<V, I, S>&& l, const R& r)
+{ // Divide the elements; the result is written into l
+
+	l = VectorOperand<Vector<V, I, S> >::Node(l) / VectorOperand<R>::Node(r);
+
+	return std::move(l);
 }
 
 template <class V, class I, class S>
-Vector<V, I, S> Vector<V, I, S>::operator / (const V& a) const
-{ // Add v to every element
+	Vector<V, I, S> operator + (Vector<V, I, S>&& l, const typename VectorOperand<Vector<V, I, S> >::value_type& a)
+{ // Add a to every element; the result is written into l
 
-	// Create new vector of same size and same starting index
-	Vector<V, I, S> result(Size(), MinIndex());
+	l = VectorOperand<Vector<V, I, S> >::Node(l) + a;
+
+	return std::move(l);
+}
 
-	// Copy all elements + v
-	for (I i = MinIndex(); i <= MaxIndex(); i++) 
-		result[i] = (*this)[i] / a;
+template <class V, class I, class S>
+	Vector<V, I, S> operator - (Vector<V, I, S>&& l, const typename VectorOperand<Vector<V, I, S> >::value_type& a)
+{ // Subtract a from every element; the result is written into l
 
-	// Return result
-	return result;
+	l = VectorOperand<Vector<V, I, S> >::Node(l) - a;
+
+	return std::move(l);
+}
+
+template <class V, class I, class S>
+	Vector<V, I, S> operator * (Vector<V, I, S>&& l, const typename VectorOperand<Vector<V, I, S> >::value_type& a)
+{ // Multiply every element by a; the result is written into l
+
+	l = VectorOperand<Vector<V, I, S> >::Node(l) * a;
+
+	return std::move(l);
 }
 
+template <class V, class I, class S>
+	Vector<V, I, S> operator / (Vector<V, I, S>&& l, const typename VectorOperand<Vector<V, I, S> >::value_type& a)
+{ // Divide every element by a; the result is written into l
+
+	l = VectorOperand<Vector<V, I, S> >::Node(l) / a;
+
+	return std::move(l);
+}
 
 template <class V, class I, class S>
-Vector<V, I, S> Vector<V, I, S>::operator + (const Vector<V, I, S>& v) const
-{ // Add the elements
+	Vector<V, I, S> operator + (const typename VectorOperand<Vector<V, I, S> >::value_type& a, Vector<V, I, S>&& r)
+{ // Add a to every element; the result is written into r
 
+	r = a + VectorOperand<Vector<V, I, S> >::Node(r);
 
-	// Create new vector of same size and same starting index
-	Vector<V, I, S> result(Size(), MinIndex());
+	return std::move(r);
+}
 
-	// Result[x]=Source[x]+v[x];
-	for (I i=MinIndex(); i<=MaxIndex(); i++) result[i] = (*this)[i] + v[i];
+template <class V, class I, class S>
+	Vector<V, I, S> operator - (const typename VectorOperand<Vector<V, I, S> >::value_type& a, Vector<V, I, S>&& r)
+{ // Subtract every element from a; the result is written into r
 
-	// Return result
-	return result;
+	r = a - VectorOperand<Vector<V, I, S> >::Node(r);
+
+	return std::move(r);
 }
 
 template <class V, class I, class S>
-Vector<V, I, S> Vector<V, I, S>::operator - (const Vector<V, I, S>& v) const
-{ // Subtract the elements
+	Vector<V, I, S> operator * (const typename VectorOperand<Vector<V, I, S> >::value_type& a, Vector<V, I, S>&& r)
+{ // Multiply every element by a; the result is written into r
 
+	r = a * VectorOperand<Vector<V, I, S> >::Node(r);
 
-	// Create new vector of same size and same starting index
-	Vector<V, I, S> result(Size(), MinIndex());
+	return std::move(r);
+}
+
+template <class V, class I, class S>
+	Vector<V, I, S> operator - (Vector<V, I, S>&& v)
+{ // Unary minus; the result is written into v
 
-	// Result[x]=Source[x]-v[x];
-	for (I i=MinIndex(); i<=MaxIndex(); i++) result[i] = (*this)[i] - v[i];
+	v = -VectorOperand<Vector<V, I, S> >::Node(v);
 
-	// Return result
-	return result;
+	return std::move(v);
 }
 
 /* ERROR PAST 
@@ -8,12 +8,16 @@
 #define Vector_hpp
 
 #include "UtilitiesDJD/VectorsAndMatrices/Array.cpp"
+#include "UtilitiesDJD/VectorsAndMatrices/VectorExpression.hpp"
 
 // Default structure is FullArray with default allocator. Default integral type is int.
+// The arithmetic operators are expression templates, see VectorExpression.hpp.
 template <class V, class I=int, class S=FullArray<V> >
 class Vector: public Array<V, I, S>
 {
 private:
+	template <class E> void Assign(const E& e);			// Evaluate e into this vector
+
 public:
 	// Constructors & destructor
 	Vector();									// Default constructor
@@ -22,40 +26,20 @@ public:
 	Vector(I size, I start, const V& val);	// Constructor with size & start index + value
 	Vector(const Vector<V, I, S>& source);		// Copy constructor
 	Vector(const Array<V, I, S>& source);		// Copy with an array as argument
+	Vector(Vector<V, I, S>&& source) noexcept;	// Move constructor
+	Vector(Array<V, I, S>&& source) noexcept;	// Move from an array
+	template <class E>
+		Vector(const VectorExpression<E>& expr);	// Evaluate an expression
 	virtual ~Vector();							// Destructor
 
 
 	// Return the sum of the elements
 	// Operators
 	Vector<V, I, S>& operator = (const Vector<V, I, S>& source);
+	Vector<V, I, S>& operator = (Vector<V, I, S>&& source) noexcept;	// Move assignment
 
-	Vector<V, I, S> operator - () const;		// Unary minus
-
-	template <class V, class I, class S>
-	friend Vector<V, I, S> operator + (const Vector<V, I, S>& v,const V& a);	// Add v to every element
-
-	template <class V, class I, class S>
-	friend Vector<V, I, S> operator + (const V& a,	const Vector<V, I, S>& v);
-
-	template <class V, class I, class S>
-	friend Vector<V, I, S> operator - (const Vector<V, I, S>& v, const V& a);	// Subtract v from every element
-
-	template <class V, class I, class S>
-	friend Vector<V, I, S> operator - (const V& a,	const Vector<V, I, S>& v);
-
-	template <class V, class I, class S>
-	friend Vector<V, I, S> operator * (const Vector<V, I, S>& v, 
-										const V& a);	// Multiply every element by v
-
-	template <class V, class I, class S>
-	friend Vector<V, I, S> operator * (const V& a,	const Vector<V, I, S>& v);
-
-	Vector<V, I, S> operator / (const V& a) const;	// Divide every element by a
-	
-	Vector<V, I, S> operator + (const Vector<V, I, S>& v) const;	// Add the elements
-	Vector<V, I, S> operator - (const Vector<V, I, S>& v) const;	// Subtract the elements
-	Vector<V, I, S> operator * (const Vector<V, I, S>& v) const;	// Multiply the elements
-	Vector<V, I, S> operator / (const Vector<V, I, S>& v) const;	// Divide the elements
+	template <class E>
+		Vector<V, I, S>& operator = (const VectorExpression<E>& expr);	// One loop, no temporaries
 
 	Vector<V, I, S>& operator += (const V& v);	// Add v to every element
 	Vector<V, I, S>& operator -= (const V& v);	// Subtract v from every element
@@ -65,8 +49,59 @@ public:
 	Vector<V, I, S>& operator += (const Vector<V, I, S>& v);// Add the elements
 	Vector<V, I, S>& operator -= (const Vector<V, I, S>& v);// Subtract the elements
 	Vector<V, I, S>& operator *= (const Vector<V, I, S>& v);// Multiply the elements
+
+	template <class E> Vector<V, I, S>& operator += (const VectorExpression<E>& expr);
+	template <class E> Vector<V, I, S>& operator -= (const VectorExpression<E>& expr);
+	template <class E> Vector<V, I, S>& operator *= (const VectorExpression<E>& expr);
 };
 
+// Vectors are leaves of vector expressions
+template <class V, class I, class S>
+struct VectorOperand<Vector<V, I, S>, void>
+{
+	static const bool value = true;
+
+	typedef VectorTerminal<V, I> node_type;
+	typedef V value_type;
+
+	static node_type Node(const Vector<V, I, S>& v) { return node_type(v.Data(), v.Size(), v.MinIndex()); }
+};
+
+// When the left operand is a temporary Vector its storage is reused for the
+// result, e.g. in f(x) * a + b the product is written into the vector that f
+// returned and no new vector is allocated.
+template <class V, class I, class S, class R>
+	typename std::enable_if<VectorOperand<R>::value, Vector<V, I, S> >::type
+	operator + (Vector<V, I, S>&& l, const R& r);
+template <class V, class I, class S, class R>
+	typename std::enable_if<VectorOperand<R>::value, Vector<V, I, S> >::type
+	operator - (Vector<V, I, S>&& l, const R& r);
+template <class V, class I, class S, class R>
+	typename std::enable_if<VectorOperand<R>::value, Vector<V, I, S> >::type
+	operator * (Vector<V, I, S>&& l, const R& r);
+template <class V, class I, class S, class R>
+	typename std::enable_if<VectorOperand<R>::value, Vector<V, I, S> >::type
+	operator / (Vector<V, I, S>&& l, const R& r);
+
+template <class V, class I, class S>
+	Vector<V, I, S> operator + (Vector<V, I, S>&& l, const typename VectorOperand<Vector<V, I, S> >::value_type& a);
+template <class V, class I, class S>
+	Vector<V, I, S> operator - (Vector<V, I, S>&& l, const typename VectorOperand<Vector<V, I, S> >::value_type& a);
+template <class V, class I, class S>
+	Vector<V, I, S> operator * (Vector<V, I, S>&& l, const typename VectorOperand<Vector<V, I, S> >::value_type& a);
+template <class V, class I, class S>
+	Vector<V, I, S> operator / (Vector<V, I, S>&& l, const typename VectorOperand<Vector<V, I, S> >::value_type& a);
+
+template <class V, class I, class S>
+	Vector<V, I, S> operator + (const typename VectorOperand<Vector<V, I, S> >::value_type& a, Vector<V, I, S>&& r);
+template <class V, class I, class S>
+	Vector<V, I, S> operator - (const typename VectorOperand<Vector<V, I, S> >::value_type& a, Vector<V, I, S>&& r);
+template <class V, class I, class S>
+	Vector<V, I, S> operator * (const typename VectorOperand<Vector<V, I, S> >::value_type& a, Vector<V, I, S>&& r);
+
+template <class V, class I, class S>
+	Vector<V, I, S> operator - (Vector<V, I, S>&& v);		// Unary minus
+
 // Some 'command' type functions that are useful in some applications. Most functions
 // are void and this promotes Efficiency. Usability is also enhanced. 
 // 
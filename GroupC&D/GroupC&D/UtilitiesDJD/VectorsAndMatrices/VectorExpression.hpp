@@ -0,0 +1,285 @@
+// VectorExpression.hpp
+//
+// Expression templates for Vector arithmetic.
+//
+// The operators +, -, * and / on vectors (elementwise) and scalars return a
+// small expression object instead of a new Vector. Nothing is computed until
+// the expression is assigned to a Vector (constructor, operator =, +=, -=, *=).
+// At that point one loop runs over the elements, with no temporary vectors.
+//
+// Leaves refer to the elements of a Vector by pointer, so an expression must
+// not outlive the vectors it uses; write
+//
+//		Vector<double, long> r = a * v1 + v2 * b;
+//
+// and not 'auto r = a * v1 + v2 * b;'.
+//
+// Elements are matched by position from the start of each vector. The result
+// takes its size and start index from the leftmost vector in the expression.
+//
+// 2026-10-19 kick-off
+//
+
+#ifndef VectorExpression_hpp
+#define VectorExpression_hpp
+
+#include <cstddef>
+#include <type_traits>
+
+
+// Elementwise operations
+struct ETPlus		{ template <class T> static T Apply(const T& a, const T& b) { return a + b; } };
+struct ETMinus		{ template <class T> static T Apply(const T& a, const T& b) { return a - b; } };
+struct ETMultiplies	{ template <class T> static T Apply(const T& a, const T& b) { return a * b; } };
+struct ETDivides	{ template <class T> static T Apply(const T& a, const T& b) { return a / b; } };
+struct ETNegate		{ template <class T> static T Apply(const T& a) { return -a; } };
+
+
+// Base class of all vector expressions (CRTP)
+template <class E>
+class VectorExpression
+{
+public:
+	const E& Derived() const { return static_cast<const E&>(*this); }
+};
+
+
+// Leaf: contiguous elements of a vector
+template <class V, class I>
+class VectorTerminal: public VectorExpression<VectorTerminal<V, I> >
+{
+private:
+	const V* m_data;
+	I m_size;
+	I m_start;
+
+public:
+	typedef V value_type;
+	typedef I index_type;
+
+	VectorTerminal(const V* data, I size, I start): m_data(data), m_size(size), m_start(start) {}
+
+	V At(std::size_t k) const { return m_data[k]; }
+	I Size() const { return m_size; }
+	I MinIndex() const { return m_start; }
+};
+
+
+// l op r elementwise
+template <class L, class R, class Op>
+class VectorBinary: public VectorExpression<VectorBinary<L, R, Op> >
+{
+private:
+	L m_left;
+	R m_right;
+
+public:
+	typedef typename L::value_type value_type;
+	typedef typename L::index_type index_type;
+
+	VectorBinary(const L& l, const R& r): m_left(l), m_right(r) {}
+
+	value_type At(std::size_t k) const { return Op::Apply(m_left.At(k), m_right.At(k)); }
+	index_type Size() const { return m_left.Size(); }
+	index_type MinIndex() const { return m_left.MinIndex(); }
+};
+
+
+// e op a with a scalar a
+template <class E, class Op>
+class VectorScalarRight: public VectorExpression<VectorScalarRight<E, Op> >
+{
+public:
+	typedef typename E::value_type value_type;
+	typedef typename E::index_type index_type;
+
+private:
+	E m_expr;
+	value_type m_scalar;
+
+public:
+	VectorScalarRight(const E& e, const value_type& a): m_expr(e), m_scalar(a) {}
+
+	value_type At(std::size_t k) const { return Op::Apply(m_expr.At(k), m_scalar); }
+	index_type Size() const { return m_expr.Size(); }
+	index_type MinIndex() const { return m_expr.MinIndex(); }
+};
+
+
+// a op e with a scalar a
+template <class E, class Op>
+class VectorScalarLeft: public VectorExpression<VectorScalarLeft<E, Op> >
+{
+public:
+	typedef typename E::value_type value_type;
+	typedef typename E::index_type index_type;
+
+private:
+	value_type m_scalar;
+	E m_expr;
+
+public:
+	VectorScalarLeft(const value_type& a, const E& e): m_scalar(a), m_expr(e) {}
+
+	value_type At(std::size_t k) const { return Op::Apply(m_scalar, m_expr.At(k)); }
+	index_type Size() const { return m_expr.Size(); }
+	index_type MinIndex() const { return m_expr.MinIndex(); }
+};
+
+
+// op e
+template <class E, class Op>
+class VectorUnary: public VectorExpression<VectorUnary<E, Op> >
+{
+private:
+	E m_expr;
+
+public:
+	typedef typename E::value_type value_type;
+	typedef typename E::index_type index_type;
+
+	explicit VectorUnary(const E& e): m_expr(e) {}
+
+	value_type At(std::size_t k) const { return Op::Apply(m_expr.At(k)); }
+	index_type Size() const { return m_expr.Size(); }
+	index_type MinIndex() const { return m_expr.MinIndex(); }
+};
+
+
+// Which types may appear in a vector expression and how they become nodes.
+// Expressions are used as they are; Vector gets a specialisation in Vector.hpp.
+template <class T, class Enable = void>
+struct VectorOperand
+{
+	static const bool value = false;
+};
+
+template <class E>
+struct VectorOperand<E, typename std::enable_if<std::is_base_of<VectorExpression<E>, E>::value>::type>
+{
+	static const bool value = true;
+
+	typedef E node_type;
+	typedef typename E::value_type value_type;
+
+	static const E& Node(const E& e) { return e; }
+};
+
+
+// Operators. They only take part in overload resolution when the operands
+// are vectors or vector expressions.
+
+template <class L, class R>
+	typename std::enable_if<VectorOperand<L>::value && VectorOperand<R>::value,
+		VectorBinary<typename VectorOperand<L>::node_type, typename VectorOperand<R>::node_type, ETPlus> >::type
+	operator + (const L& l, const R& r)
+{ // Add the elements
+
+	return VectorBinary<typename VectorOperand<L>::node_type, typename VectorOperand<R>::node_type, ETPlus>
+		(VectorOperand<L>::Node(l), VectorOperand<R>::Node(r));
+}
+
+template <class L, class R>
+	typename std::enable_if<VectorOperand<L>::value && VectorOperand<R>::value,
+		VectorBinary<typename VectorOperand<L>::node_type, typename VectorOperand<R>::node_type, ETMinus> >::type
+	operator - (const L& l, const R& r)
+{ // Subtract the elements
+
+	return VectorBinary<typename VectorOperand<L>::node_type, typename VectorOperand<R>::node_type, ETMinus>
+		(VectorOperand<L>::Node(l), VectorOperand<R>::Node(r));
+}
+
+template <class L, class R>
+	typename std::enable_if<VectorOperand<L>::value && VectorOperand<R>::value,
+		VectorBinary<typename VectorOperand<L>::node_type, typename VectorOperand<R>::node_type, ETMultiplies> >::type
+	operator * (const L& l, const R& r)
+{ // Multiply the elements
+
+	return VectorBinary<typename VectorOperand<L>::node_type, typename VectorOperand<R>::node_type, ETMultiplies>
+		(VectorOperand<L>::Node(l), VectorOperand<R>::Node(r));
+}
+
+template <class L, class R>
+	typename std::enable_if<VectorOperand<L>::value && VectorOperand<R>::value,
+		VectorBinary<typename VectorOperand<L>::node_type, typename VectorOperand<R>::node_type, ETDivides> >::type
+	operator / (const L& l, const R& r)
+{ // Divide the elements
+
+	return VectorBinary<typename VectorOperand<L>::node_type, typename VectorOperand<R>::node_type, ETDivides>
+		(VectorOperand<L>::Node(l), VectorOperand<R>::Node(r));
+}
+
+template <class L>
+	typename std::enable_if<VectorOperand<L>::value,
+		VectorScalarRight<typename VectorOperand<L>::node_type, ETPlus> >::type
+	operator + (const L& l, const typename VectorOperand<L>::value_type& a)
+{ // Add a to every element
+
+	return VectorScalarRight<typename VectorOperand<L>::node_type, ETPlus>(VectorOperand<L>::Node(l), a);
+}
+
+template <class R>
+	typename std::enable_if<VectorOperand<R>::value,
+		VectorScalarLeft<typename VectorOperand<R>::node_type, ETPlus> >::type
+	operator + (const typename VectorOperand<R>::value_type& a, const R& r)
+{ // Add a to every element
+
+	return VectorScalarLeft<typename VectorOperand<R>::node_type, ETPlus>(a, VectorOperand<R>::Node(r));
+}
+
+template <class L>
+	typename std::enable_if<VectorOperand<L>::value,
+		VectorScalarRight<typename VectorOperand<L>::node_type, ETMinus> >::type
+	operator - (const L& l, const typename VectorOperand<L>::value_type& a)
+{ // Subtract a from every element
+
+	return VectorScalarRight<typename VectorOperand<L>::node_type, ETMinus>(VectorOperand<L>::Node(l), a);
+}
+
+template <class R>
+	typename std::enable_if<VectorOperand<R>::value,
+		VectorScalarLeft<typename VectorOperand<R>::node_type, ETMinus> >::type
+	operator - (const typename VectorOperand<R>::value_type& a, const R& r)
+{ // Subtract every element from a
+
+	return VectorScalarLeft<typename VectorOperand<R>::node_type, ETMinus>(a, VectorOperand<R>::Node(r));
+}
+
+template <class L>
+	typename std::enable_if<VectorOperand<L>::value,
+		VectorScalarRight<typename VectorOperand<L>::node_type, ETMultiplies> >::type
+	operator * (const L& l, const typename VectorOperand<L>::value_type& a)
+{ // Multiply every element by a
+
+	return VectorScalarRight<typename VectorOperand<L>::node_type, ETMultiplies>(VectorOperand<L>::Node(l), a);
+}
+
+template <class R>
+	typename std::enable_if<VectorOperand<R>::value,
+		VectorScalarLeft<typename VectorOperand<R>::node_type, ETMultiplies> >::type
+	operator * (const typename VectorOperand<R>::value_type& a, const R& r)
+{ // Multiply every element by a
+
+	return VectorScalarLeft<typename VectorOperand<R>::node_type, ETMultiplies>(a, VectorOperand<R>::Node(r));
+}
+
+template <class L>
+	typename std::enable_if<VectorOperand<L>::value,
+		VectorScalarRight<typename VectorOperand<L>::node_type, ETDivides> >::type
+	operator / (const L& l, const typename VectorOperand<L>::value_type& a)
+{ // Divide every element by a
+
+	return VectorScalarRight<typename VectorOperand<L>::node_type, ETDivides>(VectorOperand<L>::Node(l), a);
+}
+
+template <class E>
+	typename std::enable_if<VectorOperand<E>::value,
+		VectorUnary<typename VectorOperand<E>::node_type, ETNegate> >::type
+	operator - (const E& e)
+{ // Unary minus
+
+	return VectorUnary<typename VectorOperand<E>::node_type, ETNegate>(VectorOperand<E>::Node(e));
+}
+
+
+#endif	// VectorExpression_hpp
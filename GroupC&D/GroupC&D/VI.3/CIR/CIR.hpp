@@ -5,6 +5,8 @@
 // 
 // 2011-7-28 DD using Longstaff notation
 // 2011-9-14 DD print vectors and matrices of values
+// 2026-10-19 priceCIR(r, t) through CIRModel; use CIRModel (CIRCurve.hpp)
+//				for curves and surfaces and when the parameters are not global
 //
 // (C) Datasim Education BV 2009-2011
 //
@@ -15,6 +17,7 @@
 #include <vector>
 #include <cmath>
 #include <iostream>
+#include "CIRCurve.hpp"
 using namespace std;
 
 
@@ -30,18 +33,7 @@ namespace AffineModel
 double priceCIR (double r, double t)
 { // CIR of a zero-coupon bond
 
-	double gamma = sqrt(b*b + 2.0*sig*sig);
-
-	double expm1 = exp(gamma*t) - 1.0;
-	double gammapb = gamma + b;
-
-	double B = (2.0 * expm1) / (gammapb*expm1 + 2.0*gamma);
-
-	double factor = 2.0 * gamma * exp(0.5*gammapb*t) / (gammapb*expm1 + 2.0*gamma);
-
-	double A = pow(factor, 2.0*a/(sig*sig));
-
-	return A * exp(- B*r);
+	return CIRModel(a, b, sig).Price(r, t);
 }
 
 
@@ -0,0 +1,230 @@
+// CIRCurve.hpp
+//
+// CIR zero-coupon bond curves and discount surfaces P(r, t) = A(t) exp(-B(t) r).
+//
+// gamma, the exponentials, A and B depend on t only. CIRModel computes them
+// once per tenor (Coefficients()); a curve is then one exp(-B r) per rate,
+// evaluated a register at a time with the GCC/Clang vector extensions (as in
+// VectorSpaceKernels). Other compilers use std::exp.
+//
+// The parameters are members of an immutable CIRModel, not namespace globals
+// as in CIR.hpp, so one model can be shared by threads and several models can
+// be used at once.
+//
+// A surface is contiguous and row-major: one row per tenor, one column per
+// rate, so that each row is one sweep.
+//
+// 2026-10-19 kick-off
+//
+
+#ifndef CIRCurve_HPP
+#define CIRCurve_HPP
+
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+namespace AffineModel
+{
+	// Coefficients of one tenor: P(r, t) = A exp(-B r)
+	struct CIRTenor
+	{
+		double t;
+		double A;
+		double B;
+	};
+
+	// Bond prices; row n is tenor n, column i is rate i
+	class CIRSurface
+	{
+	private:
+		std::vector<double> m_rates;
+		std::vector<double> m_tenors;
+		std::vector<double> m_values;
+
+	public:
+		CIRSurface(const std::vector<double>& rates, const std::vector<double>& tenors)
+			: m_rates(rates), m_tenors(tenors), m_values(rates.size() * tenors.size()) {}
+
+		std::size_t Rows() const { return m_tenors.size(); }
+		std::size_t Columns() const { return m_rates.size(); }
+
+		const std::vector<double>& Rates() const { return m_rates; }
+		const std::vector<double>& Tenors() const { return m_tenors; }
+
+		double operator () (std::size_t n, std::size_t i) const { return m_values[n * m_rates.size() + i]; }
+
+		double* Row(std::size_t n) { return m_values.data() + n * m_rates.size(); }
+		const double* Row(std::size_t n) const { return m_values.data() + n * m_rates.size(); }
+	};
+
+
+	namespace CIRKernels
+	{
+		// out[i] = A exp(-B r[i])
+		inline void DiscountLoop(const double* r, std::size_t count, double A, double B, double* out)
+		{
+			for (std::size_t i = 0; i < count; ++i) out[i] = A * std::exp(-B * r[i]);
+		}
+
+#if defined(__GNUC__)
+
+		// Cody-Waite reduction x = k ln2 + z, |z| <= ln2/2, and a degree 13
+		// Taylor polynomial for exp(z); agrees with std::exp to a few ulp
+		template <class P, class M> inline P vexp(const P& x)
+		{
+			const double shifter = 6755399441055744.0;		// 1.5 2^52: adding it rounds to an integer
+			const double log2e = 1.4426950408889634;
+			const double ln2hi = 0.6931471803691238;
+			const double ln2lo = 1.9082149292705877e-10;
+
+			P t = x * log2e + shifter;
+			P k = t - shifter;
+			P z = (x - k * ln2hi) - k * ln2lo;
+
+			P p = P() + 1.0 / 6227020800.0;
+			p = p * z + 1.0 / 479001600.0;
+			p = p * z + 1.0 / 39916800.0;
+			p = p * z + 1.0 / 3628800.0;
+			p = p * z + 1.0 / 362880.0;
+			p = p * z + 1.0 / 40320.0;
+			p = p * z + 1.0 / 5040.0;
+			p = p * z + 1.0 / 720.0;
+			p = p * z + 1.0 / 120.0;
+			p = p * z + 1.0 / 24.0;
+			p = p * z + 1.0 / 6.0;
+			p = p * z + 0.5;
+			p = p * z + 1.0;
+			p = p * z + 1.0;
+
+			// 2^k: k is in the low bits of t
+			M scale = ((M) t + 1023) << 52;
+
+			return p * (P) scale;
+		}
+
+#if defined(__AVX__)
+		typedef double CIRDouble __attribute__((vector_size(32)));
+		typedef long long CIRMask __attribute__((vector_size(32)));
+#else
+		typedef double CIRDouble __attribute__((vector_size(16)));
+		typedef long long CIRMask __attribute__((vector_size(16)));
+#endif
+
+		inline void Discount(const double* r, std::size_t count, double A, double B, double* out)
+		{ // A register at a time; if any -B r is outside the normal range of exp
+		  // (or NaN) the sweep is done again with std::exp
+
+			const std::size_t W = sizeof(CIRDouble) / sizeof(double);
+
+			CIRMask outside = CIRMask();
+
+			std::size_t i = 0;
+			for (; i + W <= count; i += W)
+			{
+				CIRDouble x;
+				__builtin_memcpy(&x, r + i, sizeof(x));
+				x = -B * x;
+
+				outside |= ~((x > -708.0) & (x < 709.0));
+
+				CIRDouble y = A * vexp<CIRDouble, CIRMask>(x);
+				__builtin_memcpy(out + i, &y, sizeof(y));
+			}
+
+			bool any = false;
+			for (std::size_t w = 0; w < W; ++w) any = any || outside[w];
+
+			if (any) i = 0;
+
+			DiscountLoop(r + i, count - i, A, B, out + i);
+		}
+
+#else
+
+		inline void Discount(const double* r, std::size_t count, double A, double B, double* out)
+		{
+			DiscountLoop(r, count, A, B, out);
+		}
+
+#endif	// __GNUC__
+	}
+
+
+	// dr = (a - br)dt + sig r^1/2 dW
+	class CIRModel
+	{
+	private:
+		double m_a;			// aka alpha
+		double m_b;			// aka kappa
+		double m_sig;
+
+		double m_gamma;		// sqrt(b^2 + 2 sig^2)
+		double m_power;		// 2a / sig^2
+
+	public:
+		CIRModel(double a, double b, double sig)
+			: m_a(a), m_b(b), m_sig(sig), m_gamma(std::sqrt(b*b + 2.0*sig*sig)), m_power(2.0*a/(sig*sig)) {}
+
+		double a() const { return m_a; }
+		double b() const { return m_b; }
+		double sig() const { return m_sig; }
+
+		CIRTenor Coefficients(double t) const
+		{ // The terms that do not depend on r
+
+			double expm1 = std::exp(m_gamma*t) - 1.0;
+			double gammapb = m_gamma + m_b;
+			double denominator = gammapb*expm1 + 2.0*m_gamma;
+
+			double factor = 2.0 * m_gamma * std::exp(0.5*gammapb*t) / denominator;
+
+			CIRTenor result;
+			result.t = t;
+			result.B = (2.0 * expm1) / denominator;
+			result.A = std::pow(factor, m_power);
+
+			return result;
+		}
+
+		double Price(double r, double t) const
+		{ // CIR of a zero-coupon bond
+
+			CIRTenor c = Coefficients(t);
+			return c.A * std::exp(- c.B*r);
+		}
+
+		// out[i] = P(r[i], t)
+		void Curve(const double* r, std::size_t count, double t, double* out) const
+		{
+			CIRTenor c = Coefficients(t);
+			CIRKernels::Discount(r, count, c.A, c.B, out);
+		}
+
+		std::vector<double> Curve(const std::vector<double>& rates, double t) const
+		{
+			std::vector<double> result(rates.size());
+			if (!rates.empty()) Curve(&rates[0], rates.size(), t, &result[0]);
+
+			return result;
+		}
+
+		CIRSurface Surface(const std::vector<double>& rates, const std::vector<double>& tenors) const
+		{
+			CIRSurface result(rates, tenors);
+
+			if (!rates.empty())
+			{
+				for (std::size_t n = 0; n < tenors.size(); ++n)
+				{
+					Curve(&rates[0], rates.size(), tenors[n], result.Row(n));
+				}
+			}
+
+			return result;
+		}
+	};
+
+} // end of namespace 'AffineModel'
+
+#endif	// CIRCurve_HPP
@@ -2,11 +2,15 @@
 //
 // Defining parameters of CIR zcb
 //
+// 2026-10-19 CIRModel surfaces against priceCIR, and their speed
+//
 // (C) Datasim Education BV 2009-2011
 //
 
 #include "CIR.hpp"
 
+#include <algorithm>
+#include <chrono>
 #include <vector>
 #include <iostream>
 using namespace std;
@@ -75,5 +79,45 @@ int main()
 	vector<vector<double>> result = priceCIR(xarr, tarr, affineModel);
 	print(result);
 
+	// The same surface from a model object: one row per tenor
+	CIRModel model(a, b, sig);
+	CIRSurface surface = model.Surface(xarr, tarr);
+
+	double diff = 0.0;
+	for (std::size_t n = 0; n < tarr.size(); ++n)
+	{
+		for (std::size_t i = 0; i < xarr.size(); ++i)
+		{
+			diff = std::max(diff, std::fabs(surface(n, i) - result[i][n]));
+		}
+	}
+	cout << "CIRModel surface, difference with priceCIR: " << diff << endl;
+
+	// A large discount surface both ways
+	long NRL = 2000; long NTL = 500;
+	vector<double> rates(NRL), tenors(NTL);
+	for (long i = 0; i < NRL; ++i) rates[i] = rMin + (rMax - rMin) * double(i) / double(NRL - 1);
+	for (long n = 0; n < NTL; ++n) tenors[n] = 30.0 * double(n + 1) / double(NTL);
+
+	auto t0 = std::chrono::steady_clock::now();
+	vector<vector<double>> cells = priceCIR(rates, tenors, affineModel);
+	auto t1 = std::chrono::steady_clock::now();
+	CIRSurface large = model.Surface(rates, tenors);
+	auto t2 = std::chrono::steady_clock::now();
+
+	double relative = 0.0;
+	for (long n = 0; n < NTL; ++n)
+	{
+		for (long i = 0; i < NRL; ++i)
+		{
+			relative = std::max(relative, std::fabs(large(n, i) - cells[i][n]) / cells[i][n]);
+		}
+	}
+
+	double perCell = std::chrono::duration<double>(t1 - t0).count();
+	double perTenor = std::chrono::duration<double>(t2 - t1).count();
+	cout << NRL << " x " << NTL << " surface: priceCIR per cell " << perCell << " s, CIRModel "
+		<< perTenor << " s (" << perCell / perTenor << "x), relative difference " << relative << endl;
+
 	return 0;
 }
\ No newline at end of file
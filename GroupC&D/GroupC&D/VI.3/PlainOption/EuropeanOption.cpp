@@ -17,29 +17,16 @@
 double EuropeanOption::n(double x) const
 { 
 
-	double A = 1.0/sqrt(2.0 * 3.1415);
+	double A = 1.0/sqrt(2.0 * M_PI);
 	return A * exp(-x*x*0.5);
 
 }
 
 double EuropeanOption::N(double x) const
-{ // The approximation to the cumulative normal distribution
+{ // The cumulative normal distribution. The polynomial approximation 
+  // (error 1.0e-5) is not accurate enough for BBS smoothing in the lattice
 
-
-	double a1 = 0.4361836;
-	double a2 = -0.1201676;
-	double a3 = 0.9372980;
-
-	double k = 1.0/(1.0 + (0.33267 * x));
-	
-	if (x >= 0.0)
-	{
-		return 1.0 - n(x)* (a1*k + (a2*k*k) + (a3*k*k*k));
-	}
-	else
-	{
-		return 1.0 - N(-x);
-	}
+	return 0.5 * erfc(-x * M_SQRT1_2);
 
 }
 
@@ -167,15 +154,9 @@ double EuropeanOption::Price(double U) const
 
 
 	if (optType == "C")
-	{	
-		cout << "calling call\n";
 		return CallPrice(U);
-	}
 	else
-	{
-		cout << "calling put\n";
 		return PutPrice(U);
-	}
 }	
 
 double EuropeanOption::Delta(double U) const 
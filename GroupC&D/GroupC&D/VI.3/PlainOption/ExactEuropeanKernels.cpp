@@ -0,0 +1,287 @@
+// ExactEuropeanKernels.cpp
+//
+// Haug formulae for ExactEuropeanOption on plain doubles. The functions are
+// inline so that sweeps compile to straight arithmetic.
+//
+// 2026-10-19 kick-off
+// 2026-10-19 formulae also take precomputed Terms, so several outputs share them
+//
+
+#ifndef ExactEuropeanKernels_cpp
+#define ExactEuropeanKernels_cpp
+
+#include "ExactEuropeanKernels.hpp"
+#include <cmath>
+
+namespace ExactEuropeanKernels
+{
+	//////////// Gaussian functions /////////////////////////////////
+
+	inline double n(double x)
+	{
+
+		double A = 1.0/std::sqrt(2.0 * 3.1415);
+		return A * std::exp(-x*x*0.5);
+	}
+
+	inline double N(double x)
+	{ // The approximation to the cumulative normal distribution
+
+		double a1 = 0.4361836;
+		double a2 = -0.1201676;
+		double a3 = 0.9372980;
+
+		if (x < 0.0) return 1.0 - N(-x);
+
+		double k = 1.0/(1.0 + (0.33267 * x));
+		return 1.0 - n(x)* (a1*k + (a2*k*k) + (a3*k*k*k));
+	}
+
+	inline Terms terms(const Parameters& p)
+	{
+		Terms t;
+
+		t.sqrtT = std::sqrt(p.T);
+		t.tmp = p.sig * t.sqrtT;
+		t.d1 = ( std::log(p.U/p.K) + (p.b + (p.sig*p.sig)*0.5 ) * p.T )/ t.tmp;
+		t.d2 = t.d1 - t.tmp;
+		t.carry = std::exp((p.b - p.r) * p.T);
+		t.discount = std::exp(-p.r * p.T);
+
+		return t;
+	}
+
+	// Kernel Functions (Haug)
+	inline double CallPrice(const Parameters& p, const Terms& t)
+	{
+		return (p.U * t.carry * N(t.d1)) - (p.K * t.discount * N(t.d2));
+	}
+
+	inline double CallPrice(const Parameters& p)
+	{
+		return CallPrice(p, terms(p));
+	}
+
+	inline double PutPrice(const Parameters& p, const Terms& t)
+	{
+		return (p.K * t.discount * N(-t.d2)) - (p.U * t.carry * N(-t.d1));
+	}
+
+	inline double PutPrice(const Parameters& p)
+	{
+		return PutPrice(p, terms(p));
+	}
+
+	inline double CallDelta(const Parameters&, const Terms& t)
+	{
+		return t.carry * N(t.d1);
+	}
+
+	inline double CallDelta(const Parameters& p)
+	{
+		return CallDelta(p, terms(p));
+	}
+
+	inline double PutDelta(const Parameters&, const Terms& t)
+	{
+		return t.carry * (N(t.d1) - 1.0);
+	}
+
+	inline double PutDelta(const Parameters& p)
+	{
+		return PutDelta(p, terms(p));
+	}
+
+	inline double CallGamma(const Parameters& p, const Terms& t)
+	{ // Also the put gamma
+
+		return ( n(t.d1) * t.carry ) / (p.U * t.tmp);
+	}
+
+	inline double CallGamma(const Parameters& p)
+	{
+		return CallGamma(p, terms(p));
+	}
+
+	inline double CallVega(const Parameters& p, const Terms& t)
+	{ // Also the put vega
+
+		return p.U * t.carry * n(t.d1) * t.sqrtT;
+	}
+
+	inline double CallVega(const Parameters& p)
+	{
+		return CallVega(p, terms(p));
+	}
+
+	inline double CallTheta(const Parameters& p, const Terms& t)
+	{
+		double t1 = (p.U * t.carry * n(t.d1) * p.sig * 0.5 )/ t.sqrtT;
+		double t2 = (p.b - p.r) * (p.U * t.carry * N(t.d1));
+		double t3 = p.r * p.K * t.discount * N(t.d2);
+
+		return -(t1 + t2 + t3);
+	}
+
+	inline double CallTheta(const Parameters& p)
+	{
+		return CallTheta(p, terms(p));
+	}
+
+	inline double PutTheta(const Parameters& p, const Terms& t)
+	{
+		double t1 = (p.U * t.carry * n(t.d1) * p.sig * 0.5 )/ t.sqrtT;
+		double t2 = (p.b - p.r) * (p.U * t.carry * N(-t.d1));
+		double t3 = p.r * p.K * t.discount * N(-t.d2);
+
+		return t2 + t3 - t1;
+	}
+
+	inline double PutTheta(const Parameters& p)
+	{
+		return PutTheta(p, terms(p));
+	}
+
+	inline double CallRho(const Parameters& p, const Terms& t)
+	{
+		if (p.b != 0.0) return p.T * p.K * t.discount * N(t.d2);
+
+		return - p.T * CallPrice(p, t);
+	}
+
+	inline double CallRho(const Parameters& p)
+	{
+		return CallRho(p, terms(p));
+	}
+
+	inline double PutRho(const Parameters& p, const Terms& t)
+	{
+		if (p.b != 0.0) return - p.T * p.K * t.discount * N(-t.d2);
+
+		return - p.T * PutPrice(p, t);
+	}
+
+	inline double PutRho(const Parameters& p)
+	{
+		return PutRho(p, terms(p));
+	}
+
+	inline double CallCoc(const Parameters& p, const Terms& t)
+	{
+		return p.T * p.U * t.carry * N(t.d1);
+	}
+
+	inline double CallCoc(const Parameters& p)
+	{
+		return CallCoc(p, terms(p));
+	}
+
+	inline double PutCoc(const Parameters& p, const Terms& t)
+	{
+		return - p.T * p.U * t.carry * N(-t.d1);
+	}
+
+	inline double PutCoc(const Parameters& p)
+	{
+		return PutCoc(p, terms(p));
+	}
+
+	inline double CallStrike(const Parameters&, const Terms& t)
+	{ // As a function of the strike price
+
+		return - t.discount * N(t.d2);
+	}
+
+	inline double CallStrike(const Parameters& p)
+	{
+		return CallStrike(p, terms(p));
+	}
+
+	inline double PutStrike(const Parameters&, const Terms& t)
+	{
+		return t.discount * N(-t.d2);
+	}
+
+	inline double PutStrike(const Parameters& p)
+	{
+		return PutStrike(p, terms(p));
+	}
+
+	inline double SecondStrike(const Parameters& p, const Terms& t)
+	{
+		return ( n(t.d2) * t.discount )/( p.K * t.tmp );
+	}
+
+	inline double SecondStrike(const Parameters& p)
+	{
+		return SecondStrike(p, terms(p));
+	}
+
+	inline double Evaluate(Sensitivity s, const Parameters& p, const Terms& t)
+	{
+		bool call = (p.type == Call);
+
+		switch (s)
+		{
+			case Price: return call ? CallPrice(p, t) : PutPrice(p, t);
+			case Delta: return call ? CallDelta(p, t) : PutDelta(p, t);
+			case Gamma: return CallGamma(p, t);
+			case Vega: return CallVega(p, t);
+			case Theta: return call ? CallTheta(p, t) : PutTheta(p, t);
+			case Rho: return call ? CallRho(p, t) : PutRho(p, t);
+			case Coc: return call ? CallCoc(p, t) : PutCoc(p, t);
+		}
+
+		return 0.0;
+	}
+
+	inline double Evaluate(Sensitivity s, const Parameters& p)
+	{
+		return Evaluate(s, p, terms(p));
+	}
+
+	inline double& Field(Parameters& p, Parameter x)
+	{
+		switch (x)
+		{
+			case InterestRate: return p.r;
+			case Volatility: return p.sig;
+			case Strike: return p.K;
+			case Underlying: return p.U;
+			case CostOfCarry: return p.b;
+			case Expiry: break;
+		}
+
+		return p.T;
+	}
+
+	template <Sensitivity s>
+		inline void sweep(Parameter x, const Parameters& base, const double* values, double* out, std::size_t count)
+	{ // The formula is fixed at compile time, so the loop body is arithmetic only
+
+		Parameters p = base;
+		double& field = Field(p, x);
+
+		for (std::size_t i = 0; i < count; ++i)
+		{
+			field = values[i];
+			out[i] = Evaluate(s, p);
+		}
+	}
+
+	inline void Sweep(Sensitivity s, Parameter x, const Parameters& base, const double* values, double* out, std::size_t count)
+	{
+		switch (s)
+		{
+			case Price: sweep<Price>(x, base, values, out, count); break;
+			case Delta: sweep<Delta>(x, base, values, out, count); break;
+			case Gamma: sweep<Gamma>(x, base, values, out, count); break;
+			case Vega: sweep<Vega>(x, base, values, out, count); break;
+			case Theta: sweep<Theta>(x, base, values, out, count); break;
+			case Rho: sweep<Rho>(x, base, values, out, count); break;
+			case Coc: sweep<Coc>(x, base, values, out, count); break;
+		}
+	}
+}
+
+#endif	// ExactEuropeanKernels_cpp
@@ -0,0 +1,101 @@
+// ExactEuropeanKernels.hpp
+//
+// Numeric kernels behind ExactEuropeanOption (OptionExtras.cpp): the Haug
+// formulae for price and sensitivities on plain doubles. There is no I/O, no
+// Property lookup and no string compare; the option type is an enum.
+//
+// ExactEuropeanOption takes a Parameters snapshot of its properties once per
+// call (or once per graph() sweep) and evaluates these kernels. The Gaussian
+// functions are the ones ExactEuropeanOption has always used, so the results
+// are unchanged.
+//
+// 2026-10-19 kick-off
+// 2026-10-19 formulae on precomputed Terms
+//
+
+#ifndef ExactEuropeanKernels_hpp
+#define ExactEuropeanKernels_hpp
+
+#include <cstddef>
+
+namespace ExactEuropeanKernels
+{
+	enum OptionType { Call, Put };
+
+	// What graph() can compute, and which parameter it varies
+	enum Sensitivity { Price, Delta, Gamma, Vega, Theta, Rho, Coc };
+	enum Parameter { InterestRate, Volatility, Strike, Expiry, Underlying, CostOfCarry };
+
+	// Snapshot of the option's properties
+	struct Parameters
+	{
+		double r;		// Interest rate
+		double sig;		// Volatility
+		double K;		// Strike price
+		double T;		// Expiry date
+		double U;		// Underlying asset
+		double b;		// Cost of carry
+		OptionType type;
+	};
+
+	// Terms shared by all formulae, computed once per evaluation
+	struct Terms
+	{
+		double sqrtT;
+		double tmp;			// sig * sqrt(T)
+		double d1, d2;
+		double carry;		// exp((b - r) T)
+		double discount;	// exp(-r T)
+	};
+
+	// Gaussian functions
+	double n(double x);
+	double N(double x);
+
+	Terms terms(const Parameters& p);
+
+	// Call and put formulae; the versions with Terms let several outputs share them
+	double CallPrice(const Parameters& p, const Terms& t);
+	double PutPrice(const Parameters& p, const Terms& t);
+	double CallDelta(const Parameters& p, const Terms& t);
+	double PutDelta(const Parameters& p, const Terms& t);
+	double CallGamma(const Parameters& p, const Terms& t);
+	double CallVega(const Parameters& p, const Terms& t);
+	double CallTheta(const Parameters& p, const Terms& t);
+	double PutTheta(const Parameters& p, const Terms& t);
+	double CallRho(const Parameters& p, const Terms& t);
+	double PutRho(const Parameters& p, const Terms& t);
+	double CallCoc(const Parameters& p, const Terms& t);
+	double PutCoc(const Parameters& p, const Terms& t);
+	double CallStrike(const Parameters& p, const Terms& t);
+	double PutStrike(const Parameters& p, const Terms& t);
+	double SecondStrike(const Parameters& p, const Terms& t);	// Same for calls and puts
+
+	double CallPrice(const Parameters& p);
+	double PutPrice(const Parameters& p);
+	double CallDelta(const Parameters& p);
+	double PutDelta(const Parameters& p);
+	double CallGamma(const Parameters& p);
+	double CallVega(const Parameters& p);
+	double CallTheta(const Parameters& p);
+	double PutTheta(const Parameters& p);
+	double CallRho(const Parameters& p);
+	double PutRho(const Parameters& p);
+	double CallCoc(const Parameters& p);
+	double PutCoc(const Parameters& p);
+	double CallStrike(const Parameters& p);
+	double PutStrike(const Parameters& p);
+	double SecondStrike(const Parameters& p);
+
+	// Dispatch on p.type
+	double Evaluate(Sensitivity s, const Parameters& p, const Terms& t);
+	double Evaluate(Sensitivity s, const Parameters& p);
+
+	// The member of p that a Parameter names
+	double& Field(Parameters& p, Parameter x);
+
+	// out[i] = sensitivity s with parameter x set to values[i], the rest as in base
+	void Sweep(Sensitivity s, Parameter x, const Parameters& base, const double* values, double* out, std::size_t count);
+}
+
+#endif	// ExactEuropeanKernels_hpp
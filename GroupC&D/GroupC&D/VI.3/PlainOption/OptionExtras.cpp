@@ -2,71 +2,64 @@
 //
 // A class that models a European option as an instance of an Entity object.
 //
+// 2026-10-19 formulae in ExactEuropeanKernels: no output, properties read once per call,
+//				enum option type; graph() sweeps a snapshot
+// 2026-10-19 surface(): several outputs on a grid of parameters, in parallel;
+//				graph() is its one axis case
+//
 // (C) Datasim Component Technology BV 2003
 //
 
 #include "Entity.cpp"
+#include "ExactEuropeanKernels.cpp"
+#include "SensitivitySurface.hpp"
 #include <math.h>
 #include <iostream>
 
 
 
-// Kernel Functions (Haug)
-double CallPrice() 
-{
+// Kernel Functions (Haug). The formulae are in ExactEuropeanKernels; these
+// members read the properties once and forward to them.
 
-	double tmp = sig() * sqrt(T());
+ExactEuropeanKernels::Parameters snapshot() 
+{ // Plain doubles and an enum type, taken from the properties
 
-	double d1 = ( log(U()/K()) + (b() + (sig()*sig())*0.5 ) * T() )/ tmp;
-	double d2 = d1 - tmp;
+	ExactEuropeanKernels::Parameters p;
 
-	cout << "(d1, d2): " << d1 << ", " << d2 << endl;
-	cout << "N(d1, d2): " << N(d1) << ", " << N(d2) << endl;
+	p.r = r();
+	p.sig = sig();
+	p.K = K();
+	p.T = T();
+	p.U = U();
+	p.b = b();
+	p.type = (otyp == "C") ? ExactEuropeanKernels::Call : ExactEuropeanKernels::Put;
 
-	return (U() * exp((b()-r())*T()) * N(d1)) - (K() * exp(-r() * T())* N(d2));
+	return p;
+}
 
+double CallPrice() 
+{
+	return ExactEuropeanKernels::CallPrice(snapshot());
 }
 
 double PutPrice() 
 {
-
-	double tmp = sig() * sqrt(T());
-
-	double d1 = ( log(U()/K()) + (b() + (sig()*sig())*0.5 ) * T() )/ tmp;
-	double d2 = d1 - tmp;
-	cout << "(d1, d2): " << d1 << ", " << d2 << endl;
-	cout << "N(d1, d2): " << N(d1) << ", " << N(d2) << endl;
-	return (K() * exp(-r() * T())* N(-d2)) - (U() * exp((b()-r())*T()) * N(-d1));
-
+	return ExactEuropeanKernels::PutPrice(snapshot());
 }
 
 double CallDelta() 
 {
-	double tmp = sig() * sqrt(T());
-
-	double d1 = ( log(U()/K()) + (b() + (sig()*sig())*0.5 ) * T() )/ tmp;
-
-
-	return exp((b()-r())*T()) * N(d1);
+	return ExactEuropeanKernels::CallDelta(snapshot());
 }
 
 double PutDelta() 
 {
-	double tmp = sig() * sqrt(T());
-
-	double d1 = ( log(U()/K()) + (b() + (sig()*sig())*0.5 ) * T() )/ tmp;
-
-	return exp((b()-r())*T()) * (N(d1) - 1.0);
+	return ExactEuropeanKernels::PutDelta(snapshot());
 }
 
 double CallGamma() 
 {
-	double tmp = sig() * sqrt(T());
-
-	double d1 = ( log(U()/K()) + (b() + (sig()*sig())*0.5 ) * T() )/ tmp;
-	double d2 = d1 - tmp;
-
-	return ( n(d1) * exp((b()-r())*T()) ) / (U() * tmp);
+	return ExactEuropeanKernels::CallGamma(snapshot());
 }
 
 double PutGamma() 
@@ -77,11 +70,7 @@ double PutGamma()
 
 double CallVega() 
 {
-	double tmp = sig() * sqrt(T());
-
-	double d1 = ( log(U()/K()) + (b() + (sig()*sig())*0.5 ) * T() )/ tmp;
-
-	return (U() * exp((b()-r())*T()) * n(d1) * sqrt(T()) );
+	return ExactEuropeanKernels::CallVega(snapshot());
 }
 
 double PutVega() 
@@ -91,81 +80,36 @@ double PutVega()
 
 double CallTheta() 
 {
-
-	double tmp = sig() * sqrt(T());
-
-	double d1 = ( log(U()/K()) + (b() + (sig()*sig())*0.5 ) * T() )/ tmp;
-	double d2 = d1 - tmp;
-
-	double t1 =  (U() * exp((b()-r())*T() ) * n(d1) * sig() * 0.5 )/ sqrt(T());
-	double t2 =  (b()-r())*(U() * exp((b()-r())*T()) * N(d1));
-	double t3 =  r() * K() * exp(-r() * T()) * N(d2);
-
-	return -(t1 + t2 + t3);
+	return ExactEuropeanKernels::CallTheta(snapshot());
 }
 
 
 double PutTheta() 
 {
-
-	double tmp = sig() * sqrt(T());
-
-	double d1 = ( log(U()/K()) + (b() + (sig()*sig())*0.5 ) * T() )/ tmp;
-	double d2 = d1 - tmp;
-
-	double t1 =  (U() * exp( (b()-r())*T() ) * n(d1) * sig() * 0.5 )/ sqrt(T());
-	double t2 =  (b()-r())*(U() * exp((b()-r())*T()) * N(-d1));
-	double t3 =  r() * K() * exp(-r() * T()) * N(-d2);
-
-	return t2 + t3 - t1;
+	return ExactEuropeanKernels::PutTheta(snapshot());
 }
 
 double CallRho() 
 {
-
-	double tmp = sig() * sqrt(T());
-
-	double d1 = ( log(U()/K()) + (b() + (sig()*sig())*0.5 ) * T() )/ tmp;
-	double d2 = d1 - tmp;
-
-	if (b() != 0.0)
-		return T() * K() * exp(-r() * T()) * N(d2);
-	else
-		return - T() * CallPrice();
-
+	return ExactEuropeanKernels::CallRho(snapshot());
 }
 
 
 double PutRho() 
 {
-	double tmp = sig() * sqrt(T());
-
-	double d1 = ( log(U()/K()) + (b() + (sig()*sig())*0.5 ) * T() )/ tmp;
-	double d2 = d1 - tmp;
-
-	if (b() != 0.0)
-		return - T() * K() * exp(-r() * T()) * N(-d2);
-	else
-		return - T() * PutPrice();
+	return ExactEuropeanKernels::PutRho(snapshot());
 }
 
 
 double CallCoc() 
 {
-
-	double tmp = sig() * sqrt(T());
-	double d1 = ( log(U()/K()) + (b() + (sig()*sig())*0.5 ) * T() )/ tmp;
-
-	return T() * U() * exp( (b()-r())*T() ) * N(d1);
+	return ExactEuropeanKernels::CallCoc(snapshot());
 }
 
 
 double PutCoc() 
 {
-	double tmp = sig() * sqrt(T());
-	double d1 = ( log(U()/K()) + (b() + (sig()*sig())*0.5 ) * T() )/ tmp;
-
-	return - T() * U() * exp((b()-r())*T()) * N(-d1);
+	return ExactEuropeanKernels::PutCoc(snapshot());
 }
 
 double CallElasticity(double percentageMovement) 		
@@ -182,42 +126,23 @@ double PutElasticity(double percentageMovement)
 double CallStrike() 
 { // As a function of the strike price
 
-	double tmp = sig() * sqrt(T());
-
-	double d1 = ( log(U()/K()) + (b() + (sig()*sig())*0.5 ) * T() )/ tmp;
-	double d2 = d1 - tmp;
-
-	return - exp(-r() * T()) * N(d2);
+	return ExactEuropeanKernels::CallStrike(snapshot());
 }
 
 double PutStrike() 
 {
-	double tmp = sig() * sqrt(T());
-	double d1 = ( log(U()/K()) + (b() + (sig()*sig())*0.5 ) * T() )/ tmp;
-	double d2 = d1 - tmp;
-
-	return exp(-r() * T()) * N(-d2);
+	return ExactEuropeanKernels::PutStrike(snapshot());
 }
 
 double CallSecondStrike() 
 { // As a function of the strike price
 
-	double tmp = sig() * sqrt(T());
-
-	double d1 = ( log(U()/K()) + (b() + (sig()*sig())*0.5 ) * T() )/ tmp;
-	double d2 = d1 - tmp;
-
-	return ( n(d2) * exp(-r()* T()) )/( K() * sig() * sqrt(T()) );
+	return ExactEuropeanKernels::SecondStrike(snapshot());
 }
 
 double PutSecondStrike() 
 {
-	double tmp = sig() * sqrt(T());
-
-	double d1 = ( log(U()/K()) + (b() + (sig()*sig())*0.5 ) * T() )/ tmp;
-	double d2 = d1 - tmp;
-
-	return ( n(d2) * exp(-r()* T()) )/( K() * sig() * sqrt(T()) );		
+	return ExactEuropeanKernels::SecondStrike(snapshot());
 }
 
 /////////////////////////////////////////////////////////////////////////////////////
@@ -306,72 +231,40 @@ ExactEuropeanOption& operator = ( ExactEuropeanOption& option2)
 // Functions that calculate option price and sensitivities
 double Price()  
 {
-
-	if (otyp == "C")
-	{
-	//	cout << "Call option\n";
-		return CallPrice();
-	}
-	else
-		return PutPrice();
-
+	return ExactEuropeanKernels::Evaluate(ExactEuropeanKernels::Price, snapshot());
 }
 
 double Delta()  
 {
-	if (otyp == "C")
-		return CallDelta();
-	else
-		return PutDelta();
-
+	return ExactEuropeanKernels::Evaluate(ExactEuropeanKernels::Delta, snapshot());
 }
 
 
 double Gamma()  
 {
-	if (otyp == "C")
-		return CallGamma();
-	else
-		return PutGamma();
-
+	return ExactEuropeanKernels::Evaluate(ExactEuropeanKernels::Gamma, snapshot());
 }
 
 double Vega()  
 {
-	if (otyp == "C")
-		return CallVega();
-	else
-		return PutVega();
-
+	return ExactEuropeanKernels::Evaluate(ExactEuropeanKernels::Vega, snapshot());
 }
 
 double Theta()  
 {
-	if (otyp == "C")
-		return CallTheta();
-	else
-		return PutTheta();
-
+	return ExactEuropeanKernels::Evaluate(ExactEuropeanKernels::Theta, snapshot());
 }
 
 double Rho()  
 {
-	if (otyp == "C")
-		return CallRho();
-	else
-		return PutRho();
-
+	return ExactEuropeanKernels::Evaluate(ExactEuropeanKernels::Rho, snapshot());
 }
 
 
 double Coc()  
 { // Cost of carry
 
-	if (otyp == "C")
-		return CallCoc();
-	else
-		return PutCoc();
-
+	return ExactEuropeanKernels::Evaluate(ExactEuropeanKernels::Coc, snapshot());
 }
 
 double Elasticity(double percentageMovement) 
@@ -413,106 +306,70 @@ SimplePropertySet<string, double> propertylist()
 	result.add (Property<string, double> ("Vega",Theta() ) );
 	result.add (Property<string, double> ("Rho",Rho() ) );
 	result.add (Property<string, double> ("Cost of Carry",Coc() ) );										// Cost of carry
-	
-	cout << "counbt " << result.Count();
+
 	return result;
 
 }
 
+ExactEuropeanKernels::Surface surface(const std::vector<ExactEuropeanKernels::Axis>& axes,
+					const std::vector<ExactEuropeanKernels::Sensitivity>& outputs, unsigned nThreads = 0)
+{ // Risk surface, e.g. U x sig or K x T; each grid point is a copy of the snapshot,
+  // so the option is not changed and the call is reentrant
+
+		return ExactEuropeanKernels::ComputeSurface(snapshot(), axes, outputs, nThreads);
+}
+
 Vector<double> graph( string& sensitivity_type,  string& property,
 					 Vector<double> parameter_range)
-{
-		curr = &T;		// Default x axis is time T
+{ // A surface with one axis and one output
+
+		namespace EK = ExactEuropeanKernels;	// Its enumerators share names with members
+
+		EK::Parameter x = EK::Expiry;		// Default x axis is time T
 
 		if (property == "r")
-			curr = &r;
+			x = EK::InterestRate;
 		if (property == "sig")
-			curr = &sig;
+			x = EK::Volatility;
 		if (property == "K")
-			curr = &K;
+			x = EK::Strike;
 		if (property == "T")
-			curr = &T;
+			x = EK::Expiry;
 		if (property == "U")
-			curr = &U;
+			x = EK::Underlying;
 		if (property == "b")
-			curr = &b;
-
-		// Save the value in the 'current' property 
-		double memento = (*curr)();
-
+			x = EK::CostOfCarry;
 
-		Vector<double> result (parameter_range.Size(), parameter_range.MinIndex());
+		EK::Sensitivity s;
 
 		if (sensitivity_type == "Price")
-		{
-			for (int i = parameter_range.MinIndex(); i <= parameter_range.MaxIndex(); i++)
-			{
-				(*curr)(parameter_range[i]);
-				result[i] = Price();
-			}
-		}
+			s = EK::Price;
+		else if (sensitivity_type == "Delta")
+			s = EK::Delta;
+		else if (sensitivity_type == "Gamma")
+			s = EK::Gamma;
+		else if (sensitivity_type == "Vega")
+			s = EK::Vega;
+		else if (sensitivity_type == "Theta")
+			s = EK::Theta;
+		else if (sensitivity_type == "Rho")
+			s = EK::Rho;
+		else if (sensitivity_type == "Coc")
+			s = EK::Coc;
+		else	// Unknown sensitivity: zeroes, as before
+			return Vector<double> (parameter_range.Size(), parameter_range.MinIndex(), 0.0);
 
-	
-
-		if (sensitivity_type == "Delta")
-		{
-			for (int i = parameter_range.MinIndex(); i <= parameter_range.MaxIndex(); i++)
-			{
-				(*curr)(parameter_range[i]);
-				result[i] = Delta();
-			}
-		}
-
-
-		if (sensitivity_type == "Gamma")
-		{
-			for (int i = parameter_range.MinIndex(); i <= parameter_range.MaxIndex(); i++)
-			{
-				(*curr)(parameter_range[i]);
-				result[i] = Gamma();
-			}
-		}
-
-		if (sensitivity_type == "Vega")
-		{
-			for (int i = parameter_range.MinIndex(); i <= parameter_range.MaxIndex(); i++)
-			{
-				(*curr)(parameter_range[i]);
-				result[i] = Vega();
-			}
-		}
-
-	
-		if (sensitivity_type == "Theta")
-		{
-			for (int i = parameter_range.MinIndex(); i <= parameter_range.MaxIndex(); i++)
-			{
-				(*curr)(parameter_range[i]);
-				result[i] = Theta();
-			}
-		}
+		Vector<double> result (parameter_range.Size(), parameter_range.MinIndex());
 
-		if (sensitivity_type == "Rho")
+		if (parameter_range.Size() > 0)
 		{
-			for (int i = parameter_range.MinIndex(); i <= parameter_range.MaxIndex(); i++)
-			{
-				(*curr)(parameter_range[i]);
-				result[i] = Rho();
-			}
-		}
+			const double* first = &parameter_range[parameter_range.MinIndex()];
+			std::vector<EK::Axis> axes = { EK::Axis(x, std::vector<double>(first, first + parameter_range.Size())) };
 
-		if (sensitivity_type == "Coc")
-		{
-			for (int i = parameter_range.MinIndex(); i <= parameter_range.MaxIndex(); i++)
-			{
-				(*curr)(parameter_range[i]);
-				result[i] = Coc();
-			}
+			EK::Surface curve = surface(axes, { s });
+			std::copy(curve.Data(0), curve.Data(0) + curve.Points(), &result[result.MinIndex()]);
 		}
 
-		// Now restore the old value of the property
-		(*curr)(memento);
-
 		return result;
 
 }
@@ -533,31 +390,13 @@ void toggle()
 
 double n(double x)  
 { 
-
-	double A = 1.0/sqrt(2.0 * 3.1415);
-	return A * exp(-x*x*0.5);
-
+	return ExactEuropeanKernels::n(x);
 }
 
 double N(double x)  
 { // The approximation to the cumulative normal distribution
 
-
-	double a1 = 0.4361836;
-	double a2 = -0.1201676;
-	double a3 = 0.9372980;
-
-	double k = 1.0/(1.0 + (0.33267 * x));
-	
-	if (x >= 0.0)
-	{
-		return 1.0 - n(x)* (a1*k + (a2*k*k) + (a3*k*k*k));
-	}
-	else
-	{
-		return 1.0 - N(-x);
-	}
-
+	return ExactEuropeanKernels::N(x);
 }
 
 class NewEuropeanOption : public Entity<string, double>
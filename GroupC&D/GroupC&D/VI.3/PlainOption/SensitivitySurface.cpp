@@ -0,0 +1,120 @@
+// SensitivitySurface.cpp
+//
+// Risk surfaces of ExactEuropeanOption, computed in parallel.
+//
+// 2026-10-19 kick-off
+// 2026-10-19 threads through RunParallel()
+//
+
+#include "SensitivitySurface.hpp"
+#include "ExactEuropeanKernels.cpp"
+#include "UtilitiesDJD/ExceptionClasses/DatasimException.hpp"
+#include "UtilitiesDJD/BitsAndPieces/ParallelTasks.hpp"
+#include <algorithm>
+#include <string>
+
+namespace ExactEuropeanKernels
+{
+	namespace
+	{
+		const std::size_t ChunkSize = 4096;		// Grid points per task
+	}
+
+	Surface::Surface(const std::vector<Axis>& axes, const std::vector<Sensitivity>& outputs)
+		: m_axes(axes), m_outputs(outputs), m_points(1)
+	{
+		if (m_axes.empty() || m_outputs.empty())
+		{
+			throw DatasimException("Need at least one axis and one output", "Surface",
+									std::to_string(m_axes.size()) + " axes, " + std::to_string(m_outputs.size()) + " outputs");
+		}
+
+		for (std::size_t d = 0; d < m_axes.size(); ++d)
+		{
+			for (std::size_t e = 0; e < d; ++e)
+			{
+				if (m_axes[e].parameter == m_axes[d].parameter)
+				{
+					throw DatasimException("Parameter appears on two axes", "Surface",
+											"Axes " + std::to_string(e) + " and " + std::to_string(d));
+				}
+			}
+
+			m_points *= m_axes[d].values.size();
+		}
+
+		m_data.resize(m_points * m_outputs.size());
+	}
+
+	double Surface::operator () (std::size_t k, const std::vector<std::size_t>& index) const
+	{
+		std::size_t offset = 0;
+		for (std::size_t d = 0; d < m_axes.size(); ++d) offset = offset * Extent(d) + index[d];
+
+		return Data(k)[offset];
+	}
+
+	double Surface::operator () (std::size_t k, std::size_t i, std::size_t j) const
+	{
+		return Data(k)[i * Extent(1) + j];
+	}
+
+	double Surface::operator () (std::size_t k, std::size_t i, std::size_t j, std::size_t l) const
+	{
+		return Data(k)[(i * Extent(1) + j) * Extent(2) + l];
+	}
+
+
+	Surface ComputeSurface(const Parameters& base, const std::vector<Axis>& axes,
+							const std::vector<Sensitivity>& outputs, unsigned nThreads)
+	{
+		Surface result(axes, outputs);
+
+		const std::size_t dims = result.Dimensions();
+		const std::size_t points = result.Points();
+		const std::size_t nOut = result.Outputs();
+		const std::size_t chunks = (points + ChunkSize - 1) / ChunkSize;
+
+		RunParallel(chunks, nThreads, [&](ParallelTasks& tasks)
+		{
+			std::vector<std::size_t> index(dims);
+
+			for (std::size_t c; tasks.Next(c); )
+			{
+				std::size_t first = c * ChunkSize;
+				std::size_t last = std::min(points, first + ChunkSize);
+
+				// Own copy of the option, set to the first point of the chunk
+				Parameters p = base;
+				std::size_t rest = first;
+				for (std::size_t d = dims; d-- > 0; )
+				{
+					index[d] = rest % result.Extent(d);
+					rest /= result.Extent(d);
+					Field(p, axes[d].parameter) = axes[d].values[index[d]];
+				}
+
+				for (std::size_t q = first; q < last; ++q)
+				{
+					Terms t = terms(p);
+					for (std::size_t k = 0; k < nOut; ++k) result.Data(k)[q] = Evaluate(outputs[k], p, t);
+
+					// Next grid point: the last axis fastest
+					for (std::size_t d = dims; d-- > 0; )
+					{
+						if (++index[d] < result.Extent(d))
+						{
+							Field(p, axes[d].parameter) = axes[d].values[index[d]];
+							break;
+						}
+
+						index[d] = 0;
+						Field(p, axes[d].parameter) = axes[d].values[0];
+					}
+				}
+			}
+		});
+
+		return result;
+	}
+}
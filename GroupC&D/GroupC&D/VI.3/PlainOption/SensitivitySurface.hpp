@@ -0,0 +1,74 @@
+// SensitivitySurface.hpp
+//
+// Risk surfaces of ExactEuropeanOption: several outputs (price and Greeks) on
+// the grid spanned by two or more parameter axes, e.g. U x sig or K x T x sig,
+// in one call.
+//
+// The option is a Parameters snapshot that is never changed; every grid point
+// works on its own copy, so the grid is shared out to threads and the call is
+// reentrant. d1, d2 and the discount factors are computed once per point and
+// shared by all outputs.
+//
+// The result is contiguous: output k is one block of Points() values in
+// row-major order, the last axis varying fastest. For two axes, block k is an
+// Extent(0) x Extent(1) matrix.
+//
+// 2026-10-19 kick-off
+//
+
+#ifndef SensitivitySurface_hpp
+#define SensitivitySurface_hpp
+
+#include "ExactEuropeanKernels.hpp"
+#include <vector>
+
+namespace ExactEuropeanKernels
+{
+	// A parameter and the values it takes
+	struct Axis
+	{
+		Parameter parameter;
+		std::vector<double> values;
+
+		Axis(Parameter x, const std::vector<double>& points): parameter(x), values(points) {}
+
+		// Any range of doubles, e.g. a MeshView
+		template <class Range>
+			Axis(Parameter x, const Range& points): parameter(x), values(points.begin(), points.end()) {}
+	};
+
+	class Surface
+	{
+	private:
+		std::vector<Axis> m_axes;
+		std::vector<Sensitivity> m_outputs;
+		std::vector<double> m_data;		// [output][axis 0]...[axis d-1]
+		std::size_t m_points;
+
+	public:
+		Surface(const std::vector<Axis>& axes, const std::vector<Sensitivity>& outputs);
+
+		std::size_t Dimensions() const { return m_axes.size(); }
+		std::size_t Extent(std::size_t d) const { return m_axes[d].values.size(); }
+		std::size_t Points() const { return m_points; }
+		std::size_t Outputs() const { return m_outputs.size(); }
+
+		const Axis& GetAxis(std::size_t d) const { return m_axes[d]; }
+		Sensitivity Output(std::size_t k) const { return m_outputs[k]; }
+
+		// Block of output k
+		double* Data(std::size_t k) { return m_data.data() + k * m_points; }
+		const double* Data(std::size_t k) const { return m_data.data() + k * m_points; }
+
+		// Output k at the grid point with one index per axis
+		double operator () (std::size_t k, const std::vector<std::size_t>& index) const;
+		double operator () (std::size_t k, std::size_t i, std::size_t j) const;
+		double operator () (std::size_t k, std::size_t i, std::size_t j, std::size_t l) const;
+	};
+
+	// All outputs on the grid of the axes, around base; nThreads == 0 uses all cores
+	Surface ComputeSurface(const Parameters& base, const std::vector<Axis>& axes,
+							const std::vector<Sensitivity>& outputs, unsigned nThreads = 0);
+}
+
+#endif	// SensitivitySurface_hpp
@@ -0,0 +1,72 @@
+// TestExactEuropeanKernels.cpp
+//
+// The numeric kernels of ExactEuropeanOption against EuropeanOption (which
+// uses the exact normal distribution), put-call parity, sensitivities against
+// divided differences, and the speed of a graph() style sweep.
+//
+// 2026-10-19 kick-off
+//
+
+#include "EuropeanOption.hpp"
+#include "ExactEuropeanKernels.cpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+using namespace ExactEuropeanKernels;
+
+int main()
+{
+	// Haug's example: r = 0.08, sig = 0.30, K = 65, T = 0.25, U = 60, b = r
+	Parameters call = { 0.08, 0.30, 65.0, 0.25, 60.0, 0.08, Call };
+	Parameters put = call;
+	put.type = Put;
+
+	EuropeanOption reference;
+	reference.r = call.r; reference.sig = call.sig; reference.K = call.K;
+	reference.T = call.T; reference.b = call.b;
+
+	cout << "Call " << Evaluate(Price, call) << " (exact N: " << reference.Price(call.U) << ")" << endl;
+	reference.toggle();
+	cout << "Put  " << Evaluate(Price, put) << " (exact N: " << reference.Price(put.U) << ")" << endl;
+
+	double parity = Evaluate(Price, call) - Evaluate(Price, put) - (call.U * std::exp((call.b - call.r) * call.T) - call.K * std::exp(-call.r * call.T));
+	cout << "Put-call parity error: " << parity << endl;
+
+	// Sensitivities against central differences of the kernels themselves
+	auto bump = [](Parameters p, Parameter x, double h)
+	{
+		Parameters up = p, down = p;
+		Field(up, x) += h; Field(down, x) -= h;
+		return (Evaluate(Price, up) - Evaluate(Price, down)) / (2.0 * h);
+	};
+
+	cout << "Delta " << Evaluate(Delta, call) << " / " << bump(call, Underlying, 1.0e-4) << endl;
+	cout << "Vega  " << Evaluate(Vega, call) << " / " << bump(call, Volatility, 1.0e-5) << endl;
+	cout << "Theta " << Evaluate(Theta, call) << " / " << -bump(call, Expiry, 1.0e-6) << endl;
+	cout << "Coc   " << Evaluate(Coc, call) << " / " << bump(call, CostOfCarry, 1.0e-6) << endl;
+
+	// A sweep over the underlying, as graph("Price", "U", range) does
+	const std::size_t count = 10000000;
+	std::vector<double> U(count), price(count);
+	for (std::size_t i = 0; i < count; ++i) U[i] = 30.0 + 70.0 * double(i) / double(count - 1);
+
+	auto t0 = std::chrono::steady_clock::now();
+	Sweep(Price, Underlying, call, &U[0], &price[0], count);
+	double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+
+	double check = 0.0;
+	for (std::size_t i = 0; i < count; i += count / 7)
+	{
+		Parameters p = call;
+		p.U = U[i];
+		check = std::max(check, std::fabs(price[i] - Evaluate(Price, p)));
+	}
+
+	cout << count << " prices in " << seconds << " s (" << seconds / count * 1.0e9 << " ns each), "
+		<< "difference with single calls " << check << endl;
+
+	return 0;
+}
@@ -0,0 +1,104 @@
+// TestSensitivitySurface.cpp
+//
+// Risk surfaces U x sig and K x T x sig against single kernel calls, the
+// same surface on one and on all threads, and the speed of a large surface.
+//
+// 2026-10-19 kick-off
+//
+
+#include "SensitivitySurface.hpp"
+#include "ExactEuropeanKernels.cpp"
+#include "UtilitiesDJD/ExceptionClasses/DatasimException.hpp"
+#include "UtilitiesDJD/Geometry/Range.cpp"
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <iostream>
+#include <vector>
+
+using namespace ExactEuropeanKernels;
+using namespace std;
+
+// Largest difference between the surface and one Evaluate() per grid point
+double maxDifference(const Parameters& base, const Surface& s)
+{
+	double diff = 0.0;
+	std::vector<std::size_t> index(s.Dimensions(), 0);
+
+	for (std::size_t q = 0; q < s.Points(); ++q)
+	{
+		Parameters p = base;
+		std::size_t rest = q;
+		for (std::size_t d = s.Dimensions(); d-- > 0; )
+		{
+			index[d] = rest % s.Extent(d);
+			rest /= s.Extent(d);
+			Field(p, s.GetAxis(d).parameter) = s.GetAxis(d).values[index[d]];
+		}
+
+		for (std::size_t k = 0; k < s.Outputs(); ++k)
+		{
+			diff = std::max(diff, std::fabs(s(k, index) - Evaluate(s.Output(k), p)));
+		}
+	}
+
+	return diff;
+}
+
+int main()
+{
+	Parameters call = { 0.08, 0.30, 65.0, 0.25, 60.0, 0.08, Call };
+	std::vector<Sensitivity> greeks = { Price, Delta, Gamma, Vega, Theta };
+
+	// U x sig
+	Range<double> spots(30.0, 100.0);
+	Range<double> vols(0.1, 0.6);
+
+	std::vector<Axis> uSig = { Axis(Underlying, spots.meshView(70)), Axis(Volatility, vols.meshView(50)) };
+	Surface s2 = ComputeSurface(call, uSig, greeks);
+
+	cout << "U x sig: " << s2.Extent(0) << " x " << s2.Extent(1) << ", " << s2.Outputs() << " outputs" << endl;
+	cout << "Price at U = " << s2.GetAxis(0).values[30] << ", sig = " << s2.GetAxis(1).values[20] << ": " << s2(0, 30, 20) << endl;
+	cout << "Difference with single calls " << maxDifference(call, s2) << endl;
+
+	// K x T x sig for a put
+	Parameters put = call;
+	put.type = Put;
+
+	std::vector<Axis> kTSig = { Axis(Strike, Range<double>(40.0, 90.0).meshView(25)),
+								Axis(Expiry, Range<double>(0.05, 2.0).meshView(20)),
+								Axis(Volatility, vols.meshView(10)) };
+	Surface s3 = ComputeSurface(put, kTSig, { Price, Rho, Coc });
+
+	cout << "K x T x sig: " << s3.Points() << " points, put price " << s3(0, 5, 10, 3) << endl;
+	cout << "Difference with single calls " << maxDifference(put, s3) << endl;
+
+	// The result does not depend on the number of threads
+	Surface one = ComputeSurface(call, uSig, greeks, 1);
+	Surface all = ComputeSurface(call, uSig, greeks, 8);
+
+	bool same = std::equal(one.Data(0), one.Data(0) + one.Points() * one.Outputs(), all.Data(0));
+	cout << "1 and 8 threads identical: " << (same ? "yes" : "no") << endl;
+
+	// A large surface
+	std::vector<Axis> big = { Axis(Underlying, spots.meshView(999)), Axis(Volatility, vols.meshView(999)) };
+
+	auto t0 = std::chrono::steady_clock::now();
+	Surface large = ComputeSurface(call, big, greeks);
+	double seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+
+	cout << large.Points() << " points x " << large.Outputs() << " outputs in " << seconds << " s ("
+		<< seconds / (large.Points() * large.Outputs()) * 1.0e9 << " ns per value)" << endl;
+
+	// Invalid requests
+	try
+	{
+		ComputeSurface(call, { Axis(Volatility, vols.meshView(5)), Axis(Volatility, vols.meshView(5)) }, greeks);
+	}
+	catch (DatasimException& e)
+	{
+		cout << "Expected exception: " << e.Message() << endl;
+	}
+
+	return 0;
+}
@@ -0,0 +1,211 @@
+// CIRMonteCarlo.cpp
+//
+// CIR short rate Monte Carlo with exact and QE sampling.
+//
+// 2026-10-19 kick-off
+// 2026-10-19 QE mean r decay + a phi, also for b = 0; blocks through MonteCarloBlocks
+//
+
+#include "CIRMonteCarlo.hpp"
+#include "MonteCarloBlocks.hpp"
+#include "UtilitiesDJD/RNG/NormalGenerator.hpp"
+#include "UtilitiesDJD/ExceptionClasses/DatasimException.hpp"
+#include <boost/random/gamma_distribution.hpp>
+#include <boost/random/mersenne_twister.hpp>
+#include <boost/random/poisson_distribution.hpp>
+#include <algorithm>
+#include <chrono>
+#include <cmath>
+#include <string>
+
+namespace
+{
+	const std::size_t BlockSize = 1024;		// Paths per block
+
+	// Terms of one step of length dt; they do not depend on the rate
+	struct StepTerms
+	{
+		double decay;		// exp(-b dt)
+		double c;			// Scale of the non-central chi-square
+		double halfDof;		// Half the degrees of freedom, 2a / sig^2
+		double drift;		// a (1 - exp(-b dt)) / b; the mean is r decay + drift
+		double c1, c2;		// Conditional variance c1 r + c2
+	};
+
+	StepTerms stepTerms(const AffineModel::CIRModel& m, double dt)
+	{
+		StepTerms s;
+
+		double a = m.a(), b = m.b(), sig2 = m.sig() * m.sig();
+
+		s.decay = std::exp(-b * dt);
+		double phi = (b != 0.0) ? (1.0 - s.decay) / b : dt;		// (1 - exp(-b dt)) / b
+
+		s.c = 0.25 * sig2 * phi;
+		s.halfDof = 2.0 * a / sig2;
+		s.drift = a * phi;
+
+		// Var = r sig^2 e phi + (a/2) sig^2 phi^2
+		s.c1 = sig2 * s.decay * phi;
+		s.c2 = 0.5 * a * sig2 * phi * phi;
+
+		return s;
+	}
+}
+
+
+CIRMonteCarlo::CIRMonteCarlo(const AffineModel::CIRModel& cir, double initialRate)
+	: model(cir), r0(initialRate)
+{
+	if (cir.sig() <= 0.0 || cir.a() < 0.0 || initialRate < 0.0)
+	{
+		throw DatasimException("Need sig > 0, a >= 0 and r0 >= 0", "CIRMonteCarlo",
+								"a = " + std::to_string(cir.a()) + ", sig = " + std::to_string(cir.sig())
+								+ ", r0 = " + std::to_string(initialRate));
+	}
+}
+
+
+CIRResult CIRMonteCarlo::Price(const RatePayoff& payoff, double T, long paths, long steps,
+								CIRScheme scheme, unsigned nThreads, unsigned int seed) const
+{
+	if (paths < 2 || steps < 1)
+	{
+		throw DatasimException("Need at least two paths and one step", "CIRMonteCarlo::Price",
+								std::to_string(paths) + " paths, " + std::to_string(steps) + " steps");
+	}
+
+	auto t0 = std::chrono::steady_clock::now();
+
+	const double dt = T / double(steps);
+	const StepTerms st = stepTerms(model, dt);
+	const double a = model.a(), b = model.b(), sig = model.sig(), sqrtdt = std::sqrt(dt);
+
+	MonteCarloBlocks blocks(paths, BlockSize);
+
+	RunParallel(blocks.Blocks(), nThreads, [&](ParallelTasks& tasks)
+	{
+		// Per thread buffers; R is [time point][path]
+		std::vector<double> R((steps + 1) * BlockSize), Z(BlockSize), integral(BlockSize), payoffs(BlockSize);
+		std::vector<const double*> rows(steps + 1);
+		for (long k = 0; k <= steps; ++k) rows[k] = &R[k * BlockSize];
+
+		for (std::size_t blk; tasks.Next(blk); )
+		{
+			std::size_t count = blocks.Count(blk);
+			unsigned int blockSeed = MonteCarloBlocks::Seed(seed, blk);
+
+			BoostNormal normal(blockSeed);
+			boost::random::mt19937 rng(blockSeed);
+
+			std::fill(&R[0], &R[0] + count, r0);
+			std::fill(&integral[0], &integral[0] + count, 0.0);
+
+			for (long k = 1; k <= steps; ++k)
+			{
+				const double* x = &R[(k - 1) * BlockSize];
+				double* y = &R[k * BlockSize];
+
+				switch (scheme)
+				{
+				case CIRExact:
+					for (std::size_t p = 0; p < count; ++p)
+					{ // Non-central chi-square = chi-square with dof + 2N, N ~ Poisson(lambda / 2)
+
+						double halfLambda = 0.5 * x[p] * st.decay / st.c;
+						long N = (halfLambda > 0.0) ? boost::random::poisson_distribution<long, double>(halfLambda)(rng) : 0;
+						double shape = st.halfDof + double(N);
+						y[p] = (shape > 0.0) ? 2.0 * st.c * boost::random::gamma_distribution<double>(shape)(rng) : 0.0;
+					}
+					break;
+
+				case CIRQuadraticExponential:
+					normal.getNormals(&Z[0], count);
+					for (std::size_t p = 0; p < count; ++p)
+					{ // Andersen (2008); the uniform of the exponential branch is N(Z)
+
+						double m = x[p] * st.decay + st.drift;
+						double s2 = st.c1 * x[p] + st.c2;
+
+						if (m <= 0.0)
+						{
+							y[p] = 0.0;
+							continue;
+						}
+
+						double psi = s2 / (m * m);
+						if (psi <= 1.5)
+						{
+							double tmp = 2.0 / psi;
+							double b2 = tmp - 1.0 + std::sqrt(tmp) * std::sqrt(tmp - 1.0);
+							double z = std::sqrt(b2) + Z[p];
+							y[p] = m / (1.0 + b2) * z * z;
+						}
+						else
+						{
+							double prob = (psi - 1.0) / (psi + 1.0);
+							double beta = (1.0 - prob) / m;
+							double U = 0.5 * std::erfc(-Z[p] / std::sqrt(2.0));
+							y[p] = (U <= prob) ? 0.0 : std::log((1.0 - prob) / (1.0 - U)) / beta;
+						}
+					}
+					break;
+
+				case CIREuler:
+					normal.getNormals(&Z[0], count);
+					for (std::size_t p = 0; p < count; ++p)
+					{
+						double plus = std::max(x[p], 0.0);
+						y[p] = x[p] + (a - b * plus) * dt + sig * std::sqrt(plus) * sqrtdt * Z[p];
+					}
+					break;
+				}
+
+				for (std::size_t p = 0; p < count; ++p)
+				{
+					integral[p] += 0.5 * dt * (std::max(x[p], 0.0) + std::max(y[p], 0.0));
+				}
+			}
+
+			for (std::size_t p = 0; p < count; ++p) integral[p] = std::exp(-integral[p]);
+
+			payoff(&rows[0], std::size_t(steps), &integral[0], count, &payoffs[0]);
+			blocks.Record(blk, &payoffs[0], count);
+		}
+	});
+
+	SampleStatistics stats = blocks.Statistics();
+
+	CIRResult result;
+	result.price = stats.mean;
+	result.stdError = stats.stdError;
+	result.paths = paths;
+	result.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - t0).count();
+
+	return result;
+}
+
+
+CIRMonteCarlo::RatePayoff CIRMonteCarlo::ZeroCouponBond()
+{
+	return [](const double* const*, std::size_t, const double* discount, std::size_t count, double* payoff)
+	{
+		std::copy(discount, discount + count, payoff);
+	};
+}
+
+CIRMonteCarlo::RatePayoff CIRMonteCarlo::BondCall(const AffineModel::CIRModel& cir, double tau, double K)
+{ // The bond at T is the closed form with coefficients for tau, computed once
+
+	AffineModel::CIRTenor c = cir.Coefficients(tau);
+
+	return [c, K](const double* const* r, std::size_t steps, const double* discount, std::size_t count, double* payoff)
+	{
+		const double* rT = r[steps];
+		for (std::size_t p = 0; p < count; ++p)
+		{
+			double bond = c.A * std::exp(-c.B * std::max(rT[p], 0.0));
+			payoff[p] = discount[p] * std::max(bond - K, 0.0);
+		}
+	};
+}
@@ -0,0 +1,73 @@
+// CIRMonteCarlo.hpp
+//
+// Monte Carlo for interest rate products under CIR
+//
+//		dr = (a - br)dt + sig r^1/2 dW
+//
+// Euler on this SDE is biased and the rate goes negative, so fine grids are
+// needed. Here the rate is advanced with the transition law itself:
+//
+//		CIRExact					r(t + dt) = c X, X non-central chi-square with
+//									4a/sig^2 degrees of freedom, sampled as a
+//									Poisson mixture of gamma variates
+//		CIRQuadraticExponential		Andersen's QE scheme: moment matched, one
+//									normal per step, nearly exact
+//		CIREuler					full truncation Euler, for comparison
+//
+// Exact and QE steps can be large; a few steps per year suffice for bonds.
+//
+// Paths are simulated in blocks as in MultiAssetMC: per block the rates are
+// stored per time point (all paths at t_1, then at t_2, ...), blocks go to
+// worker threads and each block has its own random stream, so the price does
+// not depend on the number of threads.
+//
+// 2026-10-19 kick-off
+//
+
+#ifndef CIRMonteCarlo_HPP
+#define CIRMonteCarlo_HPP
+
+#include "VI.3/CIR/CIRCurve.hpp"
+#include <functional>
+#include <vector>
+
+// Outcome of a simulation
+struct CIRResult
+{
+	double price;		// Mean payoff
+	double stdError;	// Standard error of the price
+	long paths;
+	double seconds;		// Wall clock time
+};
+
+enum CIRScheme { CIRExact, CIRQuadraticExponential, CIREuler };
+
+class CIRMonteCarlo
+{
+public:
+	// Payoffs of count paths. r[k][p] is the rate at t_k = k T / steps on path p,
+	// k = 0, ..., steps (for CIREuler the state, which can be negative); discount[p] is
+	// exp(-integral of r from 0 to T), the integral by the trapezoidal rule.
+	// Payoffs are values at time 0, so they include the discount factor.
+	typedef std::function<void (const double* const* r, std::size_t steps, const double* discount,
+								std::size_t count, double* payoff)> RatePayoff;
+
+private:
+	AffineModel::CIRModel model;
+	double r0;
+
+public:
+	CIRMonteCarlo(const AffineModel::CIRModel& cir, double initialRate);
+
+	// nThreads == 0 uses all cores
+	CIRResult Price(const RatePayoff& payoff, double T, long paths, long steps,
+					CIRScheme scheme = CIRQuadraticExponential, unsigned nThreads = 0, unsigned int seed = 1) const;
+
+	// Zero-coupon bond paying 1 at T
+	static RatePayoff ZeroCouponBond();
+
+	// Call at T on the zero-coupon bond maturing at T + tau: max(P(r_T, tau) - K, 0)
+	static RatePayoff BondCall(const AffineModel::CIRModel& cir, double tau, double K);
+};
+
+#endif	// CIRMonteCarlo_HPP
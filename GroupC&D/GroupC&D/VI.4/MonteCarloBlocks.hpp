@@ -0,0 +1,93 @@
+// MonteCarloBlocks.hpp
+//
+// Paths in blocks, for the Monte Carlo engines of this directory. The paths
+// 0 .. paths-1 are cut into blocks of a fixed size; the blocks are tasks for
+// RunParallel(). Every block has its own random stream, seeded from the seed
+// of the run and the block number, and its payoff sums are kept per block
+// and added in block order at the end. So the result does not depend on the
+// number of threads.
+//
+// 2026-10-19 kick-off
+//
+
+#ifndef MonteCarloBlocks_HPP
+#define MonteCarloBlocks_HPP
+
+#include "UtilitiesDJD/BitsAndPieces/ParallelTasks.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstddef>
+#include <vector>
+
+// Mean and standard error of a sample of payoffs
+struct SampleStatistics
+{
+	double mean;
+	double stdError;
+};
+
+class MonteCarloBlocks
+{
+private:
+	long paths;
+	std::size_t blockSize;
+	std::vector<double> sum, sumSquares;	// Per block
+
+public:
+	MonteCarloBlocks(long numberOfPaths, std::size_t pathsPerBlock)
+		: paths(numberOfPaths), blockSize(pathsPerBlock),
+		  sum((std::size_t(numberOfPaths) + pathsPerBlock - 1) / pathsPerBlock), sumSquares(sum.size())
+	{
+	}
+
+	std::size_t Blocks() const { return sum.size(); }
+
+	// Number of paths in block b; blockSize except for the last block
+	std::size_t Count(std::size_t b) const
+	{
+		return std::min(blockSize, std::size_t(paths) - b * blockSize);
+	}
+
+	// Seed of the random stream of block b
+	static unsigned int Seed(unsigned int seed, std::size_t b)
+	{
+		return seed * 2654435761u + unsigned(b);
+	}
+
+	// Records the payoffs of block b; each block is recorded by one thread
+	void Record(std::size_t b, const double* payoff, std::size_t count)
+	{
+		double s = 0.0, s2 = 0.0;
+		for (std::size_t p = 0; p < count; ++p)
+		{
+			s += payoff[p];
+			s2 += payoff[p] * payoff[p];
+		}
+
+		sum[b] = s;
+		sumSquares[b] = s2;
+	}
+
+	// Over all blocks, added in block order
+	SampleStatistics Statistics() const
+	{
+		double s = 0.0, s2 = 0.0;
+		for (std::size_t b = 0; b < sum.size(); ++b)
+		{
+			s += sum[b];
+			s2 += sumSquares[b];
+		}
+
+		double N = double(paths);
+		double mean = s / N;
+		double variance = std::max(0.0, (s2 - N * mean * mean) / (N - 1.0));
+
+		SampleStatistics result;
+		result.mean = mean;
+		result.stdError = std::sqrt(variance / N);
+
+		return result;
+	}
+};
+
+#endif
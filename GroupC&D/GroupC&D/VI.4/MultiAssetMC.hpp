@@ -0,0 +1,88 @@
+// MultiAssetMC.hpp
+//
+// Monte Carlo for options on N correlated assets, each a GBM
+//
+//		dS_i = (r - q_i) S_i dt + sig_i S_i dW_i,	dW_i dW_j = rho_ij dt
+//
+// The correlation matrix is factored once, rho = L * transpose(L), and each
+// time step maps independent normals Z to correlated ones L * Z. The log
+// prices are advanced exactly, so one step suffices for European payoffs.
+//
+// Paths are simulated in blocks. Inside a block the data is stored per asset
+// (structure of arrays: all paths of asset 1, then all of asset 2, ...), so
+// the inner loops run over paths and vectorise. Blocks are shared out to
+// worker threads; each block has its own random stream, seeded from the
+// block number, so the price does not depend on the number of threads.
+//
+// 2026-10-19 kick-off
+//
+
+#ifndef MultiAssetMC_HPP
+#define MultiAssetMC_HPP
+
+#include "UtilitiesDJD/VectorsAndMatrices/Cholesky.cpp"
+#include <functional>
+#include <vector>
+
+// Outcome of a simulation
+struct MultiAssetResult
+{
+	double price;		// Discounted mean payoff
+	double stdError;	// Standard error of the price
+	long paths;
+	double seconds;		// Wall clock time
+};
+
+class MultiAssetMC
+{
+public:
+	// Payoffs of count paths; S[i][p] is the terminal price of asset i on path p
+	typedef std::function<void (const double* const* S, std::size_t count, double* payoff)> BasketPayoff;
+
+private:
+	std::vector<double> S0, sig, q;	// Per asset
+	double r;
+	std::vector<double> L;			// Cholesky factor, row-major N x N
+
+	void init();
+
+public:
+	MultiAssetMC(const std::vector<double>& initialPrices, const std::vector<double>& volatilities,
+				const std::vector<double>& dividendYields, double interestRate,
+				const NumericMatrix<double, int>& correlation);
+
+	// Fixed, small number of assets
+	template <int N>
+		MultiAssetMC(const std::vector<double>& initialPrices, const std::vector<double>& volatilities,
+				const std::vector<double>& dividendYields, double interestRate,
+				const MatrixVectorSpace<double, N, N>& correlation);
+
+	std::size_t Assets() const { return S0.size(); }
+
+	// nThreads == 0 uses all cores
+	MultiAssetResult Price(const BasketPayoff& payoff, double T, long paths, long steps = 1,
+							unsigned nThreads = 0, unsigned int seed = 1) const;
+
+	// max(sum w_i S_i - K, 0), max(K - sum w_i S_i, 0) and max(S_1 - S_2 - K, 0)
+	static BasketPayoff BasketCall(const std::vector<double>& weights, double K);
+	static BasketPayoff BasketPut(const std::vector<double>& weights, double K);
+	static BasketPayoff Spread(double K);
+};
+
+
+template <int N>
+	MultiAssetMC::MultiAssetMC(const std::vector<double>& initialPrices, const std::vector<double>& volatilities,
+				const std::vector<double>& dividendYields, double interestRate,
+				const MatrixVectorSpace<double, N, N>& correlation)
+	: S0(initialPrices), sig(volatilities), q(dividendYields), r(interestRate), L(N * N)
+{
+	MatrixVectorSpace<double, N, N> factor = CholeskyFactor(correlation);
+	for (int i = 0; i < N; ++i)
+	{
+		for (int j = 0; j < N; ++j) L[i * N + j] = factor.mat[i][j];
+	}
+
+	init();
+}
+
+#endif	// MultiAssetMC_HPP
@@ -0,0 +1,110 @@
+// TestCIRMonteCarlo.cpp
+//
+// CIR short rate Monte Carlo against closed forms: zero-coupon bonds against
+// priceCIR with exact, QE and Euler steps (also for b = 0), a bond call
+// against the CIR (1985) formula, and the same price on one and on several
+// threads.
+//
+// 2026-10-19 kick-off
+//
+
+#include "CIRMonteCarlo.hpp"
+#include "VI.3/CIR/CIR.hpp"
+#include "UtilitiesDJD/ExceptionClasses/DatasimException.hpp"
+#include <boost/math/distributions/non_central_chi_squared.hpp>
+#include <cmath>
+#include <iostream>
+#include <string>
+
+// Call at T on the bond maturing at S (Brigo and Mercurio, (3.26))
+double BondCallPrice(const AffineModel::CIRModel& m, double r, double T, double S, double K)
+{
+	double sig2 = m.sig() * m.sig();
+	double h = std::sqrt(m.b() * m.b() + 2.0 * sig2);
+
+	AffineModel::CIRTenor toS = m.Coefficients(S), toT = m.Coefficients(T), TtoS = m.Coefficients(S - T);
+
+	double rho = 2.0 * h / (sig2 * (std::exp(h * T) - 1.0));
+	double psi = (m.b() + h) / sig2;
+	double rBar = std::log(TtoS.A / K) / TtoS.B;
+	double dof = 4.0 * m.a() / sig2;
+
+	double x1 = rho + psi + TtoS.B, x2 = rho + psi;
+	boost::math::non_central_chi_squared chi1(dof, 2.0 * rho * rho * r * std::exp(h * T) / x1);
+	boost::math::non_central_chi_squared chi2(dof, 2.0 * rho * rho * r * std::exp(h * T) / x2);
+
+	double PS = toS.A * std::exp(-toS.B * r), PT = toT.A * std::exp(-toT.B * r);
+
+	return PS * boost::math::cdf(chi1, 2.0 * rBar * x1) - K * PT * boost::math::cdf(chi2, 2.0 * rBar * x2);
+}
+
+void report(const std::string& name, const CIRResult& mc, double exact)
+{
+	std::cout << name << ": MC " << mc.price << " +/- " << mc.stdError << ", exact " << exact
+			<< ", " << (mc.price - exact) / mc.stdError << " std errors, " << mc.seconds << " s" << std::endl;
+}
+
+int main()
+{
+	using namespace AffineModel;
+
+	const long paths = 200000;
+	const double r0 = 0.04, T = 5.0;
+
+	// The parameters of TestCIRExact; 2a < sig^2, so the rate reaches zero
+	a = 0.0025; b = 0.05; sig = 0.1;
+	CIRModel boundary(a, b, sig);
+	CIRMonteCarlo mc(boundary, r0);
+
+	std::cout << "2a < sig^2, zero-coupon bond T = " << T << std::endl;
+	double exact = priceCIR(r0, T);
+	report("Exact, 10 steps ", mc.Price(CIRMonteCarlo::ZeroCouponBond(), T, paths, 10, CIRExact), exact);
+	report("QE, 10 steps    ", mc.Price(CIRMonteCarlo::ZeroCouponBond(), T, paths, 10, CIRQuadraticExponential), exact);
+	report("Euler, 10 steps ", mc.Price(CIRMonteCarlo::ZeroCouponBond(), T, paths, 10, CIREuler), exact);
+	report("Euler, 500 steps", mc.Price(CIRMonteCarlo::ZeroCouponBond(), T, paths, 500, CIREuler), exact);
+
+	// Feller condition holds
+	a = 0.02; b = 0.4; sig = 0.1;
+	CIRModel feller(a, b, sig);
+	CIRMonteCarlo mc2(feller, r0);
+
+	std::cout << std::endl << "2a > sig^2, zero-coupon bond T = " << T << std::endl;
+	exact = priceCIR(r0, T);
+	report("Exact, 10 steps ", mc2.Price(CIRMonteCarlo::ZeroCouponBond(), T, paths, 10, CIRExact), exact);
+	report("QE, 10 steps    ", mc2.Price(CIRMonteCarlo::ZeroCouponBond(), T, paths, 10, CIRQuadraticExponential), exact);
+	report("Euler, 500 steps", mc2.Price(CIRMonteCarlo::ZeroCouponBond(), T, paths, 500, CIREuler), exact);
+
+	// No mean reversion; the QE mean still has the drift a dt
+	a = 0.02; b = 0.0; sig = 0.1;
+	CIRModel drift(a, b, sig);
+	CIRMonteCarlo mc3(drift, r0);
+
+	std::cout << std::endl << "b = 0, zero-coupon bond T = " << T << std::endl;
+	exact = priceCIR(r0, T);
+	report("Exact, 10 steps ", mc3.Price(CIRMonteCarlo::ZeroCouponBond(), T, paths, 10, CIRExact), exact);
+	report("QE, 10 steps    ", mc3.Price(CIRMonteCarlo::ZeroCouponBond(), T, paths, 10, CIRQuadraticExponential), exact);
+
+	// Call at T = 1 on the bond maturing at 5
+	double tExpiry = 1.0, tau = 4.0, K = 0.8;
+	std::cout << std::endl << "Bond call, T = 1, S = 5, K = " << K << std::endl;
+	exact = BondCallPrice(feller, r0, tExpiry, tExpiry + tau, K);
+	report("Exact, 2 steps  ", mc2.Price(CIRMonteCarlo::BondCall(feller, tau, K), tExpiry, paths, 2, CIRExact), exact);
+	report("QE, 2 steps     ", mc2.Price(CIRMonteCarlo::BondCall(feller, tau, K), tExpiry, paths, 2, CIRQuadraticExponential), exact);
+
+	// Blocks have their own streams: the thread count does not change the price
+	CIRResult one = mc2.Price(CIRMonteCarlo::ZeroCouponBond(), T, 50000, 10, CIRQuadraticExponential, 1);
+	CIRResult four = mc2.Price(CIRMonteCarlo::ZeroCouponBond(), T, 50000, 10, CIRQuadraticExponential, 4);
+	std::cout << std::endl << "1 thread " << one.price << ", 4 threads " << four.price
+			<< (one.price == four.price ? " (identical)" : " (DIFFERENT)") << std::endl;
+
+	try
+	{
+		mc2.Price(CIRMonteCarlo::ZeroCouponBond(), T, 1, 10);
+	}
+	catch (DatasimException& e)
+	{
+		std::cout << "Expected exception: " << e.Message() << std::endl;
+	}
+
+	return 0;
+}
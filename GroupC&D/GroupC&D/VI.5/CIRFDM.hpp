@@ -0,0 +1,323 @@
+// CIRFDM.hpp
+//
+// FDM for the CIR bond pricing PDE, in time to go t:
+//
+//		V_t = 0.5 sig^2 r V_rr + (a - br) V_r - rV,		0 <= r <= rMax
+//
+// The scheme is the theta method (theta = 1: fully implicit, the default;
+// theta = 0.5: Crank-Nicolson, started with two implicit half steps) with
+// exponential fitting of the diffusion, so the matrix stays an M-matrix near
+// r = 0 where convection dominates.
+//
+// Boundaries:
+//	r = 0		The diffusion vanishes and the drift a is >= 0, so (Fichera) no
+//				condition is imposed: the PDE itself, V_t = a V_r - 0, is solved
+//				with an upwind difference. This holds whether or not the Feller
+//				condition 2a >= sig^2 keeps the rate away from zero.
+//	r = rMax	V is taken linear in r (V_rr = 0), so the diffusion drops and
+//				V_r is the backward difference. For b rMax > a this is the
+//				upwind difference; for b rMax < a the drift comes in from
+//				outside the domain and the extrapolation is what closes it.
+//
+// The operator does not depend on time, so the tridiagonal system is factored
+// once per step size and each step is one substitution.
+//
+// Grids are shared: CIRFDM::Shared() returns the grid of (a, b, sig, rMax, J, k)
+// if one exists. A grid keeps its factorisations and the zero-coupon bonds it
+// has solved, so products on the same parameters reuse them.
+//
+// 2026-10-19 kick-off
+// 2026-10-19 r = rMax: V_rr = 0 also when the drift points into the domain
+//
+
+#ifndef CIRFDM_HPP
+#define CIRFDM_HPP
+
+#include "Mesher.hpp"
+#include "VI.3/CIR/CIRCurve.hpp"
+#include "UtilitiesDJD/VectorsAndMatrices/BandedMatrix.cpp"
+
+#include <algorithm>
+#include <cmath>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <tuple>
+#include <vector>
+
+class CIRFDM
+{
+private:
+	// Implicit and explicit parts of one step of length dt
+	struct Step
+	{
+		TridiagonalMatrix<double> implicitLU;	// LU factors of I - theta dt L
+		TridiagonalMatrix<double> explicitPart;	// I + (1 - theta) dt L
+		bool explicitNeeded;
+	};
+
+	AffineModel::CIRModel model;
+	double rMax;
+	long J;
+	double k;			// Largest time step
+	double theta;
+
+	std::vector<double> x;						// r mesh, J + 1 points
+	std::vector<double> lower, diagonal, upper;	// L, row by row
+
+	mutable std::mutex m_lock;
+	mutable std::map<std::pair<double, double>, std::shared_ptr<const Step> > m_steps;	// (dt, theta)
+	std::map<double, std::vector<double> > m_bonds;								// Time to maturity
+
+	void calculateCoefficients()
+	{ // Spatial operator L with fitted diffusion
+
+		double a = model.a(), b = model.b(), sig2 = model.sig() * model.sig();
+		double h = x[1] - x[0];
+
+		lower.assign(J + 1, 0.0); diagonal.assign(J + 1, 0.0); upper.assign(J + 1, 0.0);
+
+		// r = 0: V_t = a V_r, forward difference
+		diagonal[0] = -a / h;
+		upper[0] = a / h;
+
+		for (long j = 1; j < J; ++j)
+		{
+			double sigma = 0.5 * sig2 * x[j];
+			double mu = a - b * x[j];
+
+			// Fitting factor (mu h / 2) coth(mu h / (2 sigma)); tends to sigma as mu -> 0
+			double z = 0.5 * mu * h / sigma;
+			double rho = (std::fabs(z) < 1.0e-8) ? sigma : sigma * z / std::tanh(z);
+
+			lower[j] = rho / (h * h) - 0.5 * mu / h;
+			diagonal[j] = -2.0 * rho / (h * h) - x[j];
+			upper[j] = rho / (h * h) + 0.5 * mu / h;
+		}
+
+		// r = rMax: V linear in r (V_rr = 0), so the central V_r with the
+		// ghost value V[J+1] = 2 V[J] - V[J-1] is the backward difference
+		double mu = a - b * rMax;
+		lower[J] = -mu / h;
+		diagonal[J] = mu / h - rMax;
+	}
+
+	std::shared_ptr<const Step> step(double dt, double th) const
+	{ // Factorisation for this step size, made once
+
+		std::lock_guard<std::mutex> guard(m_lock);
+
+		std::shared_ptr<const Step>& entry = m_steps[std::make_pair(dt, th)];
+		if (entry) return entry;
+
+		std::shared_ptr<Step> s = std::make_shared<Step>();
+		std::size_t n = std::size_t(J + 1);
+		TridiagonalMatrix<double> A(n, n), B(n, n);
+
+		for (std::size_t i = 1; i <= n; ++i)
+		{
+			std::size_t j = i - 1;
+			A[i][i] = 1.0 - th * dt * diagonal[j];
+			B[i][i] = 1.0 + (1.0 - th) * dt * diagonal[j];
+
+			if (i > 1)
+			{
+				A[i][i - 1] = -th * dt * lower[j];
+				B[i][i - 1] = (1.0 - th) * dt * lower[j];
+			}
+			if (i < n)
+			{
+				A[i][i + 1] = -th * dt * upper[j];
+				B[i][i + 1] = (1.0 - th) * dt * upper[j];
+			}
+		}
+
+		s->implicitLU = A.LUFactors();
+		s->explicitPart = B;
+		s->explicitNeeded = (th < 1.0);
+
+		entry = s;
+		return entry;
+	}
+
+	void advance(std::vector<double>& V, std::vector<double>& work, const Step& s, long n) const
+	{
+		for (long i = 0; i < n; ++i)
+		{
+			if (s.explicitNeeded)
+			{
+				s.explicitPart.Multiply(&V[0], &work[0]);
+				s.implicitLU.SolveFactored(&work[0], &V[0]);
+			}
+			else
+			{
+				s.implicitLU.SolveFactored(&V[0], &V[0]);
+			}
+		}
+	}
+
+public:
+	CIRFDM(const AffineModel::CIRModel& cir, double rMaximum, long nIntervals, double timeStep, double th = 1.0)
+		: model(cir), rMax(rMaximum), J(nIntervals), k(timeStep), theta(th)
+	{
+		if (J < 2 || rMax <= 0.0 || k <= 0.0 || theta < 0.5 || theta > 1.0 || cir.a() < 0.0)
+		{
+			throw DatasimException("Need J >= 2, rMax > 0, k > 0, 0.5 <= theta <= 1 and a >= 0", "CIRFDM",
+									"J = " + std::to_string(J) + ", rMax = " + std::to_string(rMax)
+									+ ", k = " + std::to_string(k) + ", theta = " + std::to_string(theta));
+		}
+
+		Mesher mr(0.0, rMax);
+		x = mr.xarr(J);
+
+		calculateCoefficients();
+	}
+
+	// The grid of these parameters, created on first use
+	static std::shared_ptr<CIRFDM> Shared(const AffineModel::CIRModel& cir, double rMaximum, long nIntervals,
+											double timeStep, double th = 1.0)
+	{
+		typedef std::tuple<double, double, double, double, long, double, double> Key;
+		static std::mutex registryLock;
+		static std::map<Key, std::shared_ptr<CIRFDM> > registry;
+
+		std::lock_guard<std::mutex> guard(registryLock);
+
+		std::shared_ptr<CIRFDM>& grid = registry[Key(cir.a(), cir.b(), cir.sig(), rMaximum, nIntervals, timeStep, th)];
+		if (!grid) grid = std::make_shared<CIRFDM>(cir, rMaximum, nIntervals, timeStep, th);
+
+		return grid;
+	}
+
+	const std::vector<double>& xarr() const { return x; }
+	const AffineModel::CIRModel& Model() const { return model; }
+
+	void Roll(std::vector<double>& V, double tau) const
+	{ // Values tau further from maturity: ceil(tau / k) equal steps
+
+		if (tau <= 0.0) return;
+
+		long n = std::max(1L, long(std::ceil(tau / k - 1.0e-9)));
+		double dt = tau / double(n);
+		std::vector<double> work(V.size());
+
+		if (theta < 1.0)
+		{ // Rannacher start: two implicit half steps damp the payoff's kinks
+
+			advance(V, work, *step(0.5 * dt, 1.0), 2);
+			--n;
+		}
+
+		advance(V, work, *step(dt, theta), n);
+	}
+
+	const std::vector<double>& ZeroCouponBond(double tau)
+	{ // P(r, tau) on the mesh, rolled on from the longest cached bond that is shorter
+
+		std::unique_lock<std::mutex> guard(m_lock);
+
+		std::map<double, std::vector<double> >::iterator it = m_bonds.find(tau);
+		if (it != m_bonds.end()) return it->second;
+
+		std::vector<double> V(x.size(), 1.0);
+		double from = 0.0;
+
+		it = m_bonds.lower_bound(tau);
+		if (it != m_bonds.begin())
+		{
+			--it;
+			V = it->second;
+			from = it->first;
+		}
+
+		guard.unlock();		// Roll() takes the lock for the factorisations
+		Roll(V, tau - from);
+		guard.lock();
+
+		return m_bonds.insert(std::make_pair(tau, V)).first->second;
+	}
+
+	std::size_t CachedBonds() const
+	{
+		std::lock_guard<std::mutex> guard(m_lock);
+		return m_bonds.size();
+	}
+
+	double Value(const std::vector<double>& V, double r) const
+	{ // Linear interpolation on the mesh
+
+		double h = x[1] - x[0];
+		long j = std::min(J - 1, std::max(0L, long(r / h)));
+		double w = (r - x[j]) / h;
+
+		return (1.0 - w) * V[j] + w * V[j + 1];
+	}
+};
+
+
+// Products on a shared CIR grid
+class CIRBondPricer
+{
+private:
+	std::shared_ptr<CIRFDM> grid;
+
+public:
+	CIRBondPricer(const AffineModel::CIRModel& cir, double rMax = 1.0, long J = 500, double k = 0.01, double theta = 1.0)
+		: grid(CIRFDM::Shared(cir, rMax, J, k, theta)) {}
+
+	const CIRFDM& Grid() const { return *grid; }
+
+	// Pays 1 at T
+	double ZeroCouponBond(double r, double T) const
+	{
+		return grid->Value(grid->ZeroCouponBond(T), r);
+	}
+
+	// Option at T on the zero-coupon bond maturing at S; the bond comes from the cache
+	double BondOption(double r, double T, double S, double K, bool call = true) const
+	{
+		std::vector<double> V = grid->ZeroCouponBond(S - T);
+		for (std::size_t j = 0; j < V.size(); ++j) V[j] = call ? std::max(V[j] - K, 0.0) : std::max(K - V[j], 0.0);
+
+		grid->Roll(V, T);
+		return grid->Value(V, r);
+	}
+
+	// Bond paying 1 at maturity and coupon at each couponTime; at each callTime the
+	// issuer may redeem it at callPrice (before that date's coupon). No call dates
+	// gives the plain coupon bond.
+	double CallableBond(double r, double maturity, const std::vector<double>& couponTimes, double coupon,
+						const std::vector<double>& callTimes = std::vector<double>(), double callPrice = 1.0) const
+	{
+		std::vector<double> events(couponTimes);
+		events.insert(events.end(), callTimes.begin(), callTimes.end());
+		std::sort(events.begin(), events.end());
+		events.erase(std::unique(events.begin(), events.end()), events.end());
+
+		std::vector<double> V(grid->xarr().size(), 1.0);
+		double t = maturity;
+
+		for (std::size_t e = events.size(); e-- > 0; )
+		{
+			double te = events[e];
+			if (te > maturity || te <= 0.0) continue;
+
+			grid->Roll(V, t - te);
+			t = te;
+
+			if (std::find(callTimes.begin(), callTimes.end(), te) != callTimes.end())
+			{
+				for (std::size_t j = 0; j < V.size(); ++j) V[j] = std::min(V[j], callPrice);
+			}
+			if (std::find(couponTimes.begin(), couponTimes.end(), te) != couponTimes.end())
+			{
+				for (std::size_t j = 0; j < V.size(); ++j) V[j] += coupon;
+			}
+		}
+
+		grid->Roll(V, t);
+		return grid->Value(V, r);
+	}
+};
+
+#endif	// CIRFDM_HPP
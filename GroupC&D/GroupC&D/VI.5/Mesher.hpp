@@ -4,8 +4,11 @@
 // an interval into J+1 mesh points, J-1 of which
 // are internal mesh points.
 //
+// 2026-10-19 points from MeshView: no accumulated rounding, b is the last point
+//
 
 #include <vector>
+#include "UtilitiesDJD/Geometry/MeshView.cpp"
 
 class Mesher
 {
@@ -24,24 +27,17 @@ public:
 			b = B;
 		}
 
+		MeshView<double> view(int J) const
+		{ // J+1 points computed on demand
+
+			return MeshView<double>(a, b, J);
+		}
+
 		std::vector<double> xarr(int J)
 		{
 			// NB Full array (includes end points)
 
-			double h = (b - a) / double (J);
-			
-			int size = J+1;
-			int start = 1;
-
-			std::vector<double> result(size, start);
-			result[0] = a;
-
-			for (unsigned int j = 1; j < result.size(); j++)
-			{
-				result[j] = result[j-1] + h;
-			}
-
-			return result;
+			return view(J).toVector();
 		}
 
 		std::vector<double> Xarr(int J)
@@ -49,20 +45,7 @@ public:
 
 			// NB Full array (includes end points)
 
-			double h = (b - a) / double (J);
-			
-			int size = J+1;
-			int start = 1;
-
-			std::vector<double> result(size, start);
-			result[0] = a;
-
-			for (unsigned int j = 1; j < result.size(); j++)
-			{
-				result[j] = result[j-1] + h;
-			}
-
-			return result;
+			return view(J).toVector();
 		}
 
 };
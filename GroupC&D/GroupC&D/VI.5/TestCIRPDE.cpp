@@ -0,0 +1,118 @@
+// TestCIRPDE.cpp
+//
+// CIR bonds and bond options by FDM against the closed forms: zero-coupon
+// bonds against AffineModel::priceCIR, a bond call against the CIR (1985)
+// formula, a coupon bond against the sum of its discounted cash flows, the
+// same bond when callable, bonds on a grid with rMax below a/b, and the reuse
+// of the shared grid.
+//
+// 2026-10-19 kick-off
+//
+
+#include "CIRFDM.hpp"
+#include "VI.3/CIR/CIR.hpp"
+#include <boost/math/distributions/non_central_chi_squared.hpp>
+#include <chrono>
+#include <iostream>
+
+// Call at T on the bond maturing at S (Brigo and Mercurio, (3.26))
+double BondCallPrice(const AffineModel::CIRModel& m, double r, double T, double S, double K)
+{
+	double sig2 = m.sig() * m.sig();
+	double h = std::sqrt(m.b() * m.b() + 2.0 * sig2);
+
+	AffineModel::CIRTenor toS = m.Coefficients(S), toT = m.Coefficients(T), TtoS = m.Coefficients(S - T);
+
+	double rho = 2.0 * h / (sig2 * (std::exp(h * T) - 1.0));
+	double psi = (m.b() + h) / sig2;
+	double rBar = std::log(TtoS.A / K) / TtoS.B;
+	double dof = 4.0 * m.a() / sig2;
+
+	double x1 = rho + psi + TtoS.B, x2 = rho + psi;
+	boost::math::non_central_chi_squared chi1(dof, 2.0 * rho * rho * r * std::exp(h * T) / x1);
+	boost::math::non_central_chi_squared chi2(dof, 2.0 * rho * rho * r * std::exp(h * T) / x2);
+
+	double PS = toS.A * std::exp(-toS.B * r), PT = toT.A * std::exp(-toT.B * r);
+
+	return PS * boost::math::cdf(chi1, 2.0 * rBar * x1) - K * PT * boost::math::cdf(chi2, 2.0 * rBar * x2);
+}
+
+int main()
+{
+	using namespace AffineModel;
+
+	// Feller condition holds, then the parameters of TestCIRExact where it does not
+	double params[2][3] = { { 0.02, 0.4, 0.1 }, { 0.0025, 0.05, 0.1 } };
+
+	for (int m = 0; m < 2; ++m)
+	{
+		a = params[m][0]; b = params[m][1]; sig = params[m][2];
+		CIRModel model(a, b, sig);
+
+		for (double theta = 1.0; theta >= 0.5; theta -= 0.5)
+		{
+			CIRBondPricer pricer(model, 1.0, 500, 0.01, theta);
+
+			cout << "a = " << a << ", b = " << b << ", sig = " << sig << ", 2a " << (2.0 * a >= sig * sig ? ">=" : "<")
+				<< " sig^2, theta = " << theta << endl;
+
+			double err = 0.0;
+			for (double T = 1.0; T <= 10.0; T += 1.0)
+			{
+				for (double r = 0.0; r <= 0.2; r += 0.02)
+				{
+					err = std::max(err, std::fabs(pricer.ZeroCouponBond(r, T) - priceCIR(r, T)));
+				}
+			}
+			cout << "Zero-coupon bonds, T = 1..10, r = 0..0.2: max error " << err << endl;
+			cout << "P(0.04, 5) " << pricer.ZeroCouponBond(0.04, 5.0) << ", exact " << priceCIR(0.04, 5.0) << endl;
+
+			double call = pricer.BondOption(0.04, 1.0, 5.0, 0.8);
+			cout << "Call T = 1 on bond S = 5, K = 0.8: " << call << ", exact " << BondCallPrice(model, 0.04, 1.0, 5.0, 0.8) << endl;
+
+			// 5% annual coupons over 5 years, callable at par from year 2
+			std::vector<double> coupons = { 1.0, 2.0, 3.0, 4.0, 5.0 };
+			std::vector<double> calls = { 2.0, 3.0, 4.0 };
+
+			double cashFlows = priceCIR(0.04, 5.0);
+			for (std::size_t i = 0; i < coupons.size(); ++i) cashFlows += 0.05 * priceCIR(0.04, coupons[i]);
+
+			cout << "Coupon bond " << pricer.CallableBond(0.04, 5.0, coupons, 0.05) << ", cash flows " << cashFlows
+				<< ", callable " << pricer.CallableBond(0.04, 5.0, coupons, 0.05, calls, 1.0) << endl << endl;
+		}
+	}
+
+	// rMax below the mean a/b: the drift at rMax points into the domain
+	a = 0.06; b = 0.2; sig = 0.1;
+	CIRModel reverting(a, b, sig);
+
+	for (double rMax = 0.2; rMax <= 0.5; rMax += 0.15)
+	{
+		CIRBondPricer pricer(reverting, rMax, 400, 0.01, 0.5);
+
+		double err = 0.0;
+		for (double r = 0.0; r <= 0.2; r += 0.02)
+		{
+			err = std::max(err, std::fabs(pricer.ZeroCouponBond(r, 5.0) - priceCIR(r, 5.0)));
+		}
+		cout << "a/b = " << a / b << ", rMax = " << rMax << ", theta = 0.5: zero-coupon bonds T = 5, r = 0..0.2: max error " << err << endl;
+	}
+	cout << endl;
+
+	// Products on the same (a, b, sig) share the grid and its bonds
+	CIRModel model(0.02, 0.4, 0.1);
+
+	auto t0 = std::chrono::steady_clock::now();
+	CIRBondPricer first(model, 1.0, 2000, 0.001);
+	double v1 = first.BondOption(0.04, 1.0, 10.0, 0.6);
+	auto t1 = std::chrono::steady_clock::now();
+	CIRBondPricer second(model, 1.0, 2000, 0.001);
+	double v2 = second.BondOption(0.04, 1.0, 10.0, 0.65);
+	auto t2 = std::chrono::steady_clock::now();
+
+	cout << "Bond options on a 2000 x 10000 grid: first " << v1 << " in " << std::chrono::duration<double>(t1 - t0).count()
+		<< " s, second " << v2 << " in " << std::chrono::duration<double>(t2 - t1).count() << " s; "
+		<< (&first.Grid() == &second.Grid() ? "same grid, " : "different grids, ") << second.Grid().CachedBonds() << " cached bonds" << endl;
+
+	return 0;
+}
@@ -0,0 +1,192 @@
+// BatchPricer.cpp
+//
+// Non-interactive, multi-threaded pricing of a file of contracts
+// with the Binomial Method.
+//
+// Last Modification Dates:
+//
+//	2026-10-19 kick-off
+//	2026-10-19 threads through RunParallel()
+//
+
+#ifndef BatchPricer_cpp
+#define BatchPricer_cpp
+
+#include "BatchPricer.hpp"
+#include "UtilitiesDJD/BitsAndPieces/ParallelTasks.hpp"
+
+#include <fstream>
+#include <sstream>
+#include <iostream>
+#include <iomanip>
+#include <algorithm>
+#include <chrono>
+using namespace std;
+
+static int strategyNumber(const string& name)
+{ // Menu number of a strategy given by number or by name
+
+	const char* names[] = {"CRR", "JR", "TRG", "EQP", "ModCRR", "PadeJR", "PadeCRR"};
+	for (int i = 0; i < 7; i++)
+	{
+		if (name == names[i])
+			return i + 1;
+	}
+
+	istringstream is(name);
+	int choice = 0;
+	if (!(is >> choice) || !is.eof())
+		return 0;
+
+	return choice;
+}
+
+vector<OptionSpec> readOptionSpecs(const string& fileName)
+{
+
+	vector<OptionSpec> result;
+
+	ifstream in(fileName.c_str());
+	if (!in)
+	{
+		throw DatasimException("Cannot open file", "readOptionSpecs", fileName);
+	}
+
+	string line;
+	long lineNumber = 0;
+	while (getline(in, line))
+	{
+		lineNumber++;
+
+		replace(line.begin(), line.end(), ',', ' ');
+		istringstream is(line);
+
+		string type, strategy;
+		OptionSpec spec;
+		spec.line = lineNumber;
+
+		if (!(is >> type) || type[0] == '#')
+			continue;	// Empty line or comment
+
+		if (!(is >> spec.S >> spec.opt.K >> spec.opt.T >> spec.opt.r >> spec.opt.sig >> strategy >> spec.N))
+		{
+			if (lineNumber > 1)	// First line may be a header
+				cout << "Line " << lineNumber << ": expected 8 fields, skipped\n";
+			continue;
+		}
+
+		if (type == "C" || type == "c" || type == "1")
+			spec.opt.type = 1;
+		else if (type == "P" || type == "p" || type == "2")
+			spec.opt.type = 2;
+		else
+		{
+			cout << "Line " << lineNumber << ": unknown option type " << type << ", skipped\n";
+			continue;
+		}
+
+		spec.strategy = strategyNumber(strategy);
+		if (spec.strategy < 1 || spec.strategy > 7)
+		{
+			cout << "Line " << lineNumber << ": unknown strategy " << strategy << ", skipped\n";
+			continue;
+		}
+
+		result.push_back(spec);
+	}
+
+	return result;
+}
+
+static BatchResult priceOne(const OptionSpec& spec, BinomialAcceleration acc)
+{
+
+	BatchResult result;
+	result.price = result.error = 0.0;
+	result.status = "OK";
+
+	chrono::steady_clock::time_point start = chrono::steady_clock::now();
+
+	if (spec.N < 1 || spec.opt.T <= 0.0 || spec.opt.sig <= 0.0 || spec.S <= 0.0 || spec.opt.K <= 0.0)
+	{
+		result.status = "invalid parameters";
+	}
+	else
+	{
+		try
+		{
+			BinomialEstimate est = binomialEstimate(spec.opt, spec.S, spec.N, spec.strategy, acc);
+			result.price = est.price;
+			result.error = est.error;
+		}
+		catch (DatasimException& e)
+		{
+			result.status = e.Message();
+		}
+	}
+
+	chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+	result.seconds = elapsed.count();
+
+	return result;
+}
+
+vector<BatchResult> priceBatch(const vector<OptionSpec>& specs, unsigned nThreads,
+								BinomialAcceleration acc)
+{
+
+	vector<BatchResult> results(specs.size());
+
+	// Each worker takes the next unpriced contract until all are done, so
+	// long and short contracts balance over the threads
+	RunParallel(specs.size(), nThreads, [&](ParallelTasks& tasks)
+	{
+		for (size_t i; tasks.Next(i); )
+		{
+			results[i] = priceOne(specs[i], acc);
+		}
+	});
+
+	return results;
+}
+
+static string csvField(const string& text)
+{ // RFC 4180 quoting, so a message with commas, quotes or new lines stays one field
+
+	string result = "\"";
+	for (size_t i = 0; i < text.size(); i++)
+	{
+		if (text[i] == '"')
+			result += '"';
+		result += text[i];
+	}
+
+	return result + "\"";
+}
+
+void writeResultsCSV(const string& fileName, const vector<OptionSpec>& specs, 
+						const vector<BatchResult>& results)
+{
+
+	ofstream out(fileName.c_str());
+	if (!out)
+	{
+		throw DatasimException("Cannot create file", "writeResultsCSV", fileName);
+	}
+
+	out << "line,type,S,K,T,r,sig,strategy,N,price,error,seconds,status\n";
+	out << setprecision(10);
+
+	for (size_t i = 0; i < specs.size(); i++)
+	{
+		const OptionSpec& s = specs[i];
+		const BatchResult& res = results[i];
+
+		out << s.line << "," << (s.opt.type == 1 ? "C" : "P") << "," << s.S << "," 
+			<< s.opt.K << "," << s.opt.T << "," << s.opt.r << "," << s.opt.sig << "," 
+			<< s.strategy << "," << s.N << "," << res.price << "," << res.error << ","
+			<< res.seconds << "," << csvField(res.status) << "\n";
+	}
+}
+
+#endif
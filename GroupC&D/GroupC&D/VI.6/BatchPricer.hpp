@@ -0,0 +1,55 @@
+// BatchPricer.hpp
+//
+// Non-interactive pricing of a file of option contracts with the
+// Binomial Method. Contracts are priced in parallel by a pool of
+// worker threads and the results, together with the time taken per 
+// contract, are written to a CSV file.
+//
+// Input format, one contract per line (comma or space separated, lines 
+// starting with '#' are skipped):
+//
+//	type, S, K, T, r, sig, strategy, N
+//
+// type is C/P (or 1/2) and strategy is a menu number 1..7 or one of
+// CRR, JR, TRG, EQP, ModCRR, PadeJR, PadeCRR.
+//
+
+#ifndef BatchPricer_hpp
+#define BatchPricer_hpp
+
+#include "BinomialAccelerator.hpp"
+
+#include <string>
+#include <vector>
+using namespace std;
+
+struct OptionSpec
+{
+	Option opt;		// Contract (K, T, r, sig, type)
+	double S;		// Underlying value
+	int strategy;	// Lattice strategy menu number
+	int N;			// Number of steps
+	long line;		// Line number in the input file
+};
+
+struct BatchResult
+{
+	double price;
+	double error;	// Error estimate (see binomialEstimate())
+	double seconds;	// Wall clock time for this contract
+	string status;	// "OK" or the reason for failure
+};
+
+// Read the contracts; invalid lines are reported and skipped
+vector<OptionSpec> readOptionSpecs(const string& fileName);
+
+// Price all contracts with nThreads worker threads (0 == all cores)
+vector<BatchResult> priceBatch(const vector<OptionSpec>& specs, unsigned nThreads,
+								BinomialAcceleration acc = NoAcceleration);
+
+// One CSV line per contract with its inputs, price and timing; the status
+// is quoted, as it may hold an exception message
+void writeResultsCSV(const string& fileName, const vector<OptionSpec>& specs, 
+						const vector<BatchResult>& results);
+
+#endif
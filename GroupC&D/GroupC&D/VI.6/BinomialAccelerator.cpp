@@ -0,0 +1,120 @@
+// BinomialAccelerator.cpp
+//
+// Convergence acceleration for the Binomial Method (BBS and
+// Richardson extrapolation).
+//
+// Last Modification Dates:
+//
+//	2026-10-19 kick-off
+//	2026-10-19 Greeks from the extended lattice
+//	2026-10-19 strategy owned by a unique_ptr
+//
+
+#ifndef BinomialAccelerator_cpp
+#define BinomialAccelerator_cpp
+
+#include "BinomialAccelerator.hpp"
+
+#include <cmath>
+#include <memory>
+using namespace std;
+
+static double latticePrice(const Option& opt, double S, int N, int strategy, bool smoothing,
+							LatticeGreeks* greeks)
+{ // With greeks != 0 the lattice gets two extra steps before the valuation date
+
+	double k = opt.T / double (N);
+	double discounting = ::exp(- opt.r*k);
+
+	std::unique_ptr<BinomialLatticeStrategy> lf(createStrategy(strategy, opt.sig, opt.r, k, S, opt.K, N));
+	if (lf == 0)
+	{
+		throw DatasimException("Unknown lattice strategy", "binomialPrice", 
+								"choose a strategy in the range 1..7");
+	}
+
+	// Forward Induction
+	BinomialMethod bn(discounting, *lf, (greeks != 0) ? N + 2 : N);
+	if (greeks != 0)
+		bn.modifyLatticeCentred(S);
+	else
+		bn.modifyLattice(S);
+
+	// Backward Induction
+	double price;
+	if (smoothing)
+	{ // Black-Scholes over the last step of size k
+
+		EuropeanOption exact;
+		exact.r = opt.r;
+		exact.sig = opt.sig;
+		exact.K = opt.K;
+		exact.T = k;
+		exact.b = opt.r;
+		exact.optType = (opt.type == 1) ? "C" : "P";
+
+		price = bn.getPriceBBS(exact, greeks);
+	}
+	else
+	{
+		Vector<double, int> Pay = bn.BasePyramidVector();
+		for (int j = Pay.MinIndex(); j <= Pay.MaxIndex(); j++)
+		{
+			Pay[j] = opt.payoff(Pay[j]);
+		}
+
+		price = bn.getPrice(std::move(Pay), greeks);
+	}
+
+	return price;
+}
+
+double binomialPrice(const Option& opt, double S, int N, int strategy, bool smoothing)
+{
+
+	return latticePrice(opt, S, N, strategy, smoothing, 0);
+}
+
+LatticeGreeks binomialGreeks(const Option& opt, double S, int N, int strategy, bool smoothing)
+{
+
+	LatticeGreeks greeks;
+	latticePrice(opt, S, N, strategy, smoothing, &greeks);
+
+	return greeks;
+}
+
+BinomialEstimate binomialEstimate(const Option& opt, double S, int N, int strategy,
+									BinomialAcceleration acc)
+{ // For an error e(N) = c/N we have e(N) = P(N/2) - P(N); the Richardson 
+  // values have error O(1/N^2) so that e(R(2N)) = (R(2N) - R(N))/3
+
+	bool smoothing = (acc == BBSSmoothing || acc == BBSRichardson);
+	int NHalf = max(N/2, 1);
+
+	double PHalf = binomialPrice(opt, S, NHalf, strategy, smoothing);
+	double P = binomialPrice(opt, S, N, strategy, smoothing);
+
+	BinomialEstimate result;
+
+	if (acc == NoAcceleration || acc == BBSSmoothing)
+	{
+		result.price = P;
+		result.error = ::fabs(PHalf - P);
+
+		return result;
+	}
+
+	// Richardson extrapolation on N and 2N
+	double P2 = binomialPrice(opt, S, 2*N, strategy, smoothing);
+
+	double R = 2.0 * P - PHalf;
+	double R2 = 2.0 * P2 - P;
+
+	result.price = R2;
+	result.error = ::fabs(R2 - R) / 3.0;
+
+	return result;
+}
+
+#endif
@@ -0,0 +1,46 @@
+// BinomialAccelerator.hpp
+//
+// Convergence acceleration for the Binomial Method. Lattice prices
+// oscillate in the number of steps N, so on their own they need a
+// very large N. We offer two remedies that can be combined:
+//
+//	BBS:		the last step is replaced by the exact Black-Scholes 
+//				price (Broadie and Detemple 1996); this removes the 
+//				oscillation and leaves a smooth O(1/N) error.
+//	Richardson:	two-point extrapolation 2 * P(2N) - P(N) that removes
+//				the leading O(1/N) error term.
+//
+// Each price comes with an estimate of its discretisation error, 
+// computed from one extra coarse lattice with N/2 steps.
+//
+
+#ifndef BinomialAccelerator_hpp
+#define BinomialAccelerator_hpp
+
+#include "Option.hpp"
+#include "BinomialMethod.hpp"
+#include "BinomialLatticeStrategy.hpp"
+#include "UtilitiesDJD/ExceptionClasses/DatasimException.hpp"
+
+enum BinomialAcceleration {NoAcceleration, BBSSmoothing, Richardson, BBSRichardson};
+
+struct BinomialEstimate
+{
+	double price;	// Option price
+	double error;	// Estimate of the discretisation error in the price
+};
+
+// Price of an option with a lattice of N steps. The strategy is given by its
+// menu number (see createStrategy()). With smoothing == true the last step
+// uses the Black-Scholes formula.
+double binomialPrice(const Option& opt, double S, int N, int strategy, bool smoothing);
+
+// Price, delta, gamma and theta from one backward induction on a lattice 
+// of N steps extended by two steps before the valuation date
+LatticeGreeks binomialGreeks(const Option& opt, double S, int N, int strategy, bool smoothing);
+
+// Accelerated price and error estimate with N steps (2N for Richardson)
+BinomialEstimate binomialEstimate(const Option& opt, double S, int N, int strategy,
+									BinomialAcceleration acc);
+
+#endif
@@ -11,6 +11,8 @@
 // Last Modification Dates:
 //
 //	2006-4-7 DD cpp file now
+//	2026-10-19 createStrategy() from menu number; no console output
+//	2026-10-19 virtual destructor
 //
 // (C) Datasim Education BV 2005-2006
 //
@@ -69,9 +71,6 @@ CRRStrategy::CRRStrategy(double vol, double interest, double delta)
 		u = ::exp(R1 + R2);
 		d = ::exp(R1 - R2);
 
-		cout << "UD " << u << ", " << d;
-
-
 		double discounting = ::exp(- r*k);
 	
 		p = 0.5;
@@ -99,9 +98,6 @@ PadeCRRStrategy::PadeCRRStrategy(double vol, double interest, double delta)
 		d = (2.0 + z2) / (2.0 - z2);
 	
 
-		cout << "UD " << u << ", " << d;
-
-
 		double discounting = ::exp(- r*k);
 	
 		p = 0.5;
@@ -207,4 +203,31 @@ ModCRRStrategy::ModCRRStrategy(double vol, double interest, double delta, double
 
 }
 
+
+BinomialLatticeStrategy* createStrategy(int choice, double sig, double r, double k,
+										double S, double K, int N)
+{
+
+	switch (choice)
+	{
+	case 1:
+		return new CRRStrategy(sig,r,k);
+	case 2:
+		return new JRStrategy(sig,r,k);
+	case 3:
+		return new TRGStrategy(sig,r,k);
+	case 4:
+		return new EQPStrategy(sig,r,k);
+	case 5:
+		return new ModCRRStrategy(sig,r,k, S, K, N);
+	case 6:
+		return new PadeJRStrategy(sig,r,k);
+	case 7:
+		return new PadeCRRStrategy(sig,r,k);
+	default:
+		return 0;
+	}
+
+}
+
 #endif
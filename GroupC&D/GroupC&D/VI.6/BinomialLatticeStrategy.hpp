@@ -35,6 +35,8 @@ protected:
 		BinomialLatticeStrategy(double vol, double interest, double delta);
 
 public:
+		virtual ~BinomialLatticeStrategy() {}	// Strategies are deleted through the base
+
 		// Useful function
 		virtual void updateLattice
 			(Lattice<double, int, 2>& source, double rootValue) const;
@@ -43,6 +45,7 @@ public:
 		double downValue() const { return d;}
 		double upValue() const { return u;}
 		double probValue() const { return p;}
+		double stepSize() const { return k;}
 		BinomialType binomialType() const { return bType;}
 
 };
@@ -99,4 +102,10 @@ public:
 };
 
 
+// Create a strategy from its menu number: 1. CRR, 2. JR, 3. TRG, 4. EQP, 
+// 5. Modified CRR, 6. Cayley JR, 7. Cayley CRR. Returns 0 for an unknown choice.
+BinomialLatticeStrategy* createStrategy(int choice, double sig, double r, double k,
+										double S, double K, int N);
+
+
 #endif
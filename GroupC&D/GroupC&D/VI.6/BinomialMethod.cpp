@@ -12,6 +12,9 @@
 //	DD 2005-2-19 New cpp file
 //	DD 2005-11-3 Debugging
 //	DD 2006-4-7 New for get lattice
+//	2026-10-19 BBS smoothing of the last step; additive lattices
+//	2026-10-19 Greeks from the first levels; centred (extended) lattice
+//	2026-10-19 getPrice() moves a temporary payoff vector into the lattice
 //
 // (C) Datasim Education BV 2004-2006
 //
@@ -27,6 +30,7 @@ BinomialMethod::BinomialMethod (double discounting, BinomialLatticeStrategy& str
 	
 		disc = discounting;
 		str = &strategy;
+		centred = false;
 		buildLattice(N);
 
 }
@@ -43,6 +47,12 @@ void BinomialMethod::modifyLattice(double U)
 		double down = str -> downValue();
 		double up = str -> upValue();
 
+		if (str -> binomialType() == Additive)
+		{ // Jumps are in log(U)
+			down = ::exp(down);
+			up = ::exp(up);
+		}
+
 		int si = lattice.MinIndex();
 		lattice[si][lattice[si].MinIndex()] = U;
 
@@ -56,22 +66,83 @@ void BinomialMethod::modifyLattice(double U)
 				}
 			}
 	
+		centred = false;
+
 		// Postcondition: we now have the complete lattice for the underlying asset
 }
 
+void BinomialMethod::modifyLatticeCentred(double U)
+{
+
+		// The middle node of level 2 is root * up * down
+		double jumps = str -> upValue() * str -> downValue();
+		if (str -> binomialType() == Additive)
+		{
+			jumps = ::exp(str -> upValue() + str -> downValue());
+		}
+
+		modifyLattice(U / jumps);
+		centred = true;
+}
+
 	
 
-double BinomialMethod::getPrice(const Vector<double, int>& RHS)
+double BinomialMethod::getPrice(const Vector<double, int>& RHS, LatticeGreeks* greeks)
 {
 			
-		double pr = str -> probValue();
-		//cout << "Prob value: " << pr << endl;
-
 		int ei = lattice.MaxIndex();
 		lattice[ei] = RHS;
 
-		// Loop from the max index to the start (min) index
-		for (int n = lattice.MaxIndex() - 1; n >= lattice.MinIndex(); n--)
+		return rollback(ei - 1, greeks);
+}
+
+double BinomialMethod::getPrice(Vector<double, int>&& RHS, LatticeGreeks* greeks)
+{
+			
+		int ei = lattice.MaxIndex();
+		lattice[ei] = std::move(RHS);
+
+		return rollback(ei - 1, greeks);
+}
+
+double BinomialMethod::getPriceBBS(const EuropeanOption& exact, LatticeGreeks* greeks)
+{ // Precondition: modifyLattice() has been called
+
+		// The level before expiry holds the underlying values; replace 
+		// them by the Black-Scholes price over the last time step
+		int ei = lattice.MaxIndex() - 1;
+		if (ei < lattice.MinIndex())
+			return 0.0;
+
+		for (int i = lattice[ei].MinIndex(); i <= lattice[ei].MaxIndex(); i++)
+		{
+				lattice[ei][i] = exact.Price(lattice[ei][i]);
+		}
+
+		return rollback(ei - 1, greeks);
+}
+
+double BinomialMethod::rollback(int start, LatticeGreeks* greeks)
+{
+
+		double pr = str -> probValue();
+
+		int si = lattice.MinIndex();
+
+		// The underlying values of the first three levels are overwritten
+		// by the rollback, so keep them for the Greeks
+		double S0 = 0.0, S1[2] = {0.0, 0.0}, S2[3] = {0.0, 0.0, 0.0};
+		bool capture = (greeks != 0) && (lattice.MaxIndex() - si >= 2);
+		if (capture)
+		{
+			S0 = lattice[si][lattice[si].MinIndex()];
+			for (int i = 0; i < 2; i++) S1[i] = lattice[si+1][lattice[si+1].MinIndex() + i];
+			for (int i = 0; i < 3; i++) S2[i] = lattice[si+2][lattice[si+2].MinIndex() + i];
+		}
+		//cout << "Prob value: " << pr << endl;
+
+		// Loop from the start index to the min index
+		for (int n = start; n >= lattice.MinIndex(); n--)
 		{
 
 		/*	for (int i = lattice[n].MinIndex(); i <= lattice[n].MaxIndex(); i++)
@@ -102,8 +173,51 @@ double BinomialMethod::getPrice(const Vector<double, int>& RHS)
 				
 		}
 
-		int si = lattice.MinIndex();
-		return lattice[si][lattice[si].MinIndex()];
+		double V0 = lattice[si][lattice[si].MinIndex()];
+
+		if (greeks != 0)
+		{
+			greeks -> price = V0;
+			greeks -> delta = greeks -> gamma = greeks -> theta = 0.0;
+		}
+
+		if (!capture)
+			return V0;
+
+		double V1[2], V2[3];
+		for (int i = 0; i < 2; i++) V1[i] = lattice[si+1][lattice[si+1].MinIndex() + i];
+		for (int i = 0; i < 3; i++) V2[i] = lattice[si+2][lattice[si+2].MinIndex() + i];
+
+		// Three point (non-uniform) differences at level 2
+		double h1 = S2[1] - S2[0];
+		double h2 = S2[2] - S2[1];
+		double Du = (V2[2] - V2[1]) / h2;
+		double Dd = (V2[1] - V2[0]) / h1;
+
+		double gamma = 2.0 * (Du - Dd) / (h1 + h2);
+		double delta;
+
+		if (centred)
+		{ // Level 2 is the valuation date and its middle node is U
+
+			delta = (Du * h1 + Dd * h2) / (h1 + h2);
+			greeks -> price = V2[1];
+		}
+		else
+		{
+			delta = (V1[1] - V1[0]) / (S1[1] - S1[0]);
+		}
+
+		// The root and the middle node of level 2 are two steps apart; correct 
+		// for any difference in the underlying (u*d != 1)
+		double dS = S2[1] - S0;
+		double theta = (V2[1] - (V0 + delta * dS + 0.5 * gamma * dS * dS)) / (2.0 * str -> stepSize());
+
+		greeks -> delta = delta;
+		greeks -> gamma = gamma;
+		greeks -> theta = theta;
+
+		return greeks -> price;
 
 }
 
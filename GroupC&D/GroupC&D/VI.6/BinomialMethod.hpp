@@ -16,11 +16,21 @@
 
 #include "lattice.cpp"
 #include "BinomialLatticeStrategy.hpp"
+#include "VI.3/PlainOption/EuropeanOption.hpp"
 #include <cmath>
 
 #include <iostream>
 using namespace std;
 
+// Sensitivities read off the first three levels of the lattice
+struct LatticeGreeks
+{
+	double price;
+	double delta;
+	double gamma;
+	double theta;	// dV/dt
+};
+
 class BinomialMethod
 {
 private:
@@ -30,6 +40,12 @@ private:
 
 		double disc;
 
+		// Root two steps before the valuation date (see modifyLatticeCentred())
+		bool centred;
+
+		// Backward Induction from level 'start' down to the root
+		double rollback(int start, LatticeGreeks* greeks);
+
 public:
 	// Default constructor
 	BinomialMethod();
@@ -43,8 +59,20 @@ public:
 	// Initialise lattice node values (Forward Induction)
 	void modifyLattice(double U);	
 
-	// Calculate derivative price (Backward Induction)
-	double getPrice(const Vector<double, int>& RHS);
+	// Forward Induction for a lattice extended two steps back in time; the 
+	// middle node of level 2 (the valuation date) is U. Build the lattice 
+	// with N + 2 steps for an option with N steps to expiry.
+	void modifyLatticeCentred(double U);
+
+	// Calculate derivative price (Backward Induction). When greeks != 0 the
+	// price, delta, gamma and theta are taken from levels 0, 1 and 2.
+	double getPrice(const Vector<double, int>& RHS, LatticeGreeks* greeks = 0);
+	double getPrice(Vector<double, int>&& RHS, LatticeGreeks* greeks = 0);	// RHS is moved into the lattice
+
+	// Calculate derivative price with the last step replaced by the exact
+	// Black-Scholes value (Broadie-Detemple BBS). The expiry of 'exact' 
+	// must be the step size of the lattice.
+	double getPriceBBS(const EuropeanOption& exact, LatticeGreeks* greeks = 0);
 
 	// Handy function to give us the size at expiry date
 	Vector<double, int> BasePyramidVector() const;
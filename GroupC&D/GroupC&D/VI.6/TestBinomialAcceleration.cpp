@@ -0,0 +1,51 @@
+// TestBinomialAcceleration.cpp
+//
+// Compare plain, BBS and Richardson binomial prices with the exact
+// Black-Scholes price.
+//
+
+#include "BinomialAccelerator.hpp"
+#include "VI.3/PlainOption/EuropeanOption.hpp"
+
+#include <iostream>
+using namespace std;
+
+int main()
+{
+	Option opt;
+	opt.K = 100.0;
+	opt.sig = 0.2;
+	opt.r = 0.05;
+	opt.T = 1.0;
+	opt.type = 2;	// Put
+
+	double S = 100.0;
+
+	EuropeanOption exact("P");
+	exact.K = opt.K; exact.sig = opt.sig; exact.r = opt.r; exact.T = opt.T; exact.b = opt.r;
+	cout << "Exact: " << exact.Price(S) << endl;
+
+	const char* names[] = {"Plain", "BBS", "Richardson", "BBS + Richardson"};
+	BinomialAcceleration modes[] = {NoAcceleration, BBSSmoothing, Richardson, BBSRichardson};
+
+	int strategy = 2;	// JR
+	try
+	{
+		for (int N = 25; N <= 400; N *= 2)
+		{
+			cout << "\nN = " << N << endl;
+			for (int m = 0; m < 4; m++)
+			{
+				BinomialEstimate est = binomialEstimate(opt, S, N, strategy, modes[m]);
+				cout << names[m] << ": " << est.price << ", error estimate: " << est.error
+					<< ", actual error: " << est.price - exact.Price(S) << endl;
+			}
+		}
+	}
+	catch (DatasimException& e)
+	{
+		e.print();
+	}
+
+	return 0;
+}
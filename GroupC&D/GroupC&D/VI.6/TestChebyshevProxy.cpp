@@ -0,0 +1,167 @@
+// TestChebyshevProxy.cpp
+//
+// Chebyshev proxies of two expensive pricers: the BBS lattice as a function of
+// (S, sig) and the explicit FDM of VI.5 as a function of (S, T). For each we
+// report the build time, the error on a validation grid and the cost of one
+// proxy evaluation against one pricer call. A proxy of the Black-Scholes formula
+// itself shows the error falling as the number of nodes grows.
+//
+// 2026-10-19 kick-off
+//
+
+#include "BinomialAccelerator.hpp"
+#include "VI.5/FDMDirector.hpp"
+#include "VI.3/PlainOption/EuropeanOption.hpp"
+#include "UtilitiesDJD/Approximation/ChebyshevProxy.hpp"
+#include "UtilitiesDJD/ExceptionClasses/DatasimException.hpp"
+
+#include <chrono>
+#include <iostream>
+using namespace std;
+
+namespace BS // Black Scholes put for the FDM
+{
+	double sig = 0.3;
+	double K = 65.0;
+	double T = 0.25;
+	double r = 0.08;
+
+	double mySigma (double x, double t) { return 0.5 * sig * sig * x * x; }
+	double myMu (double x, double t) { return r * x; }
+	double myB (double x, double t) { return -r; }
+	double myF (double x, double t) { return 0.0; }
+	double myBCL (double t) { return K * exp(-r * t); }
+	double myBCR (double t) { return 0.0; }
+	double myIC (double x) { return max(K - x, 0.0); }
+}
+
+// Nanoseconds per proxy evaluation, averaged over the box
+double proxyNanoseconds(const ChebyshevProxy& proxy, const Range<double>& rx, const Range<double>& ry)
+{
+	const long n = 200;
+	vector<double> xs = rx.mesh(n), ys = ry.mesh(n);
+
+	double sum = 0.0;
+	auto t0 = chrono::steady_clock::now();
+	for (long rep = 0; rep < 10; ++rep)
+		for (long i = 0; i <= n; ++i)
+			for (long j = 0; j <= n; ++j) sum += proxy(xs[i], ys[j]);
+	double seconds = chrono::duration<double>(chrono::steady_clock::now() - t0).count();
+
+	if (sum == 0.0) cout << "";		// Keep the loop
+	return 1.0e9 * seconds / (10.0 * (n + 1) * (n + 1));
+}
+
+void report(const string& name, const ChebyshevProxy& proxy, const ProxyError& err, double pricerSeconds,
+			const Range<double>& rx, const Range<double>& ry)
+{
+	cout << name << " " << proxy.Nx() << " x " << proxy.Ny() << " nodes: build " << proxy.BuildSeconds()
+		<< " s, max error " << err.maxError << " at (" << err.x << ", " << err.y << "), rms " << err.rmsError
+		<< " on " << err.points << " points, tail " << proxy.TailEstimate() << endl;
+	cout << "    proxy " << proxyNanoseconds(proxy, rx, ry) << " ns, pricer " << 1.0e9 * pricerSeconds << " ns per value" << endl;
+}
+
+int main()
+{
+	try
+	{
+		// Lattice: European put, BBS smoothing with Richardson, as a function of (S, sig)
+		Option opt;
+		opt.K = 100.0; opt.r = 0.05; opt.T = 1.0; opt.type = 2;
+
+		ChebyshevProxy::Pricer lattice = [opt](double S, double sig)
+		{
+			Option o(opt);
+			o.sig = sig;
+			return binomialEstimate(o, S, 200, 2, BBSRichardson).price;
+		};
+
+		Range<double> spot(80.0, 120.0), vol(0.15, 0.45);
+
+		auto t0 = chrono::steady_clock::now();
+		for (int i = 0; i < 20; ++i) lattice(100.0, 0.3);
+		double latticeSeconds = chrono::duration<double>(chrono::steady_clock::now() - t0).count() / 20.0;
+
+		cout << "Lattice, S in [80, 120], sig in [0.15, 0.45]" << endl;
+		for (long n = 8; n <= 24; n += 8)
+		{
+			ChebyshevProxy proxy(lattice, spot, vol, n, n);
+			report("Lattice", proxy, proxy.Validate(lattice, 21, 21), latticeSeconds, spot, vol);
+		}
+
+		// The lattice itself is a few 1.0e-4 from Black-Scholes, so compare with the exact price too
+		EuropeanOption exact("P");
+		exact.K = opt.K; exact.r = opt.r; exact.T = opt.T; exact.b = opt.r;
+
+		ChebyshevProxy::Pricer blackScholes = [exact](double S, double sig)
+		{
+			EuropeanOption e(exact);
+			e.sig = sig;
+			return e.Price(S);
+		};
+
+		ChebyshevProxy latticeProxy(lattice, spot, vol, 16, 16);
+		cout << "Lattice proxy against Black-Scholes: max error "
+			<< latticeProxy.Validate(blackScholes, 21, 21).maxError << endl << endl;
+
+		// Proxy of the analytic price: the pricer is smooth, so the error falls geometrically in n
+		cout << "Black-Scholes, S in [80, 120], sig in [0.15, 0.45]" << endl;
+		for (long n = 4; n <= 20; n += 4)
+		{
+			ChebyshevProxy proxy(blackScholes, spot, vol, n, n);
+			ProxyError err = proxy.Validate(blackScholes, 21, 21);
+
+			cout << "Black-Scholes " << n << " x " << n << " nodes: max error " << err.maxError << ", rms "
+				<< err.rmsError << ", tail " << proxy.TailEstimate() << endl;
+		}
+		cout << endl;
+
+		// FDM: put as a function of (S, T); one solve per sample, so one thread
+		// (the PDE is given by the global function pointers of ParabolicIBVP)
+		using namespace ParabolicIBVP;
+		sigma = BS::mySigma; mu = BS::myMu; b = BS::myB; f = BS::myF;
+		BCL = BS::myBCL; BCR = BS::myBCR; IC = BS::myIC;
+
+		const double Smax = 4.0 * BS::K;
+		const long J = 160;
+
+		ChebyshevProxy::Pricer fdm = [Smax, J](double S, double T)
+		{ // Explicit Euler: k <= h^2 / (sig Smax)^2
+
+			double h = Smax / double(J);
+			long N = long(ceil(T * 1.1 * pow(BS::sig * Smax / h, 2)));
+
+			FDMDirector fdir(Smax, T, J, N);
+			fdir.doit();
+
+			const vector<double>& V = fdir.current();
+			long j = min(J - 1, long(S / h));
+			double w = (S - fdir.xarr[j]) / h;
+
+			return (1.0 - w) * V[j] + w * V[j + 1];
+		};
+
+		Range<double> fdmSpot(50.0, 80.0), expiry(0.25, 1.0);
+
+		t0 = chrono::steady_clock::now();
+		fdm(65.0, 1.0);
+		double fdmSeconds = chrono::duration<double>(chrono::steady_clock::now() - t0).count();
+
+		cout << "FDM, S in [50, 80], T in [0.25, 1]" << endl;
+		for (long n = 6; n <= 12; n += 6)
+		{
+			ChebyshevProxy proxy(fdm, fdmSpot, expiry, n, n, 1);
+			report("FDM", proxy, proxy.Validate(fdm, 11, 11, 1), fdmSeconds, fdmSpot, expiry);
+		}
+
+		// Too few nodes are rejected
+		ChebyshevProxy bad(lattice, spot, vol, 1, 8);
+	}
+	catch (DatasimException& e)
+	{
+		cout << endl << "Expected exception: ";
+		e.print();
+	}
+
+	return 0;
+}
@@ -0,0 +1,42 @@
+// TestLatticeGreeks.cpp
+//
+// Delta, gamma and theta from a single backward induction, compared
+// with the exact Black-Scholes sensitivities.
+//
+
+#include "BinomialAccelerator.hpp"
+#include "VI.3/PlainOption/EuropeanOption.hpp"
+
+#include <iostream>
+using namespace std;
+
+int main()
+{
+	Option opt;
+	opt.K = 100.0;
+	opt.sig = 0.36;
+	opt.r = 0.1;
+	opt.T = 0.5;
+	opt.type = 1;	// Call
+
+	double S = 105.0;
+
+	// Exact price and delta; gamma and theta by divided differences
+	EuropeanOption exact;
+	exact.K = opt.K; exact.sig = opt.sig; exact.r = opt.r; exact.T = opt.T; exact.b = opt.r;
+
+	double h = 0.01;
+	double gamma = (exact.Price(S + h) - 2.0 * exact.Price(S) + exact.Price(S - h)) / (h * h);
+	EuropeanOption later(exact); later.T = opt.T - h * 0.01;
+	double theta = (later.Price(S) - exact.Price(S)) / (h * 0.01);
+
+	cout << "Exact: " << exact.Price(S) << ", " << exact.Delta(S) << ", " << gamma << ", " << theta << endl;
+
+	for (int N = 50; N <= 800; N *= 2)
+	{
+		LatticeGreeks g = binomialGreeks(opt, S, N, 2, true);
+		cout << "N = " << N << ": " << g.price << ", " << g.delta << ", " << g.gamma << ", " << g.theta << endl;
+	}
+
+	return 0;
+}
@@ -0,0 +1,68 @@
+// batchdirector.cpp
+//
+// Headless version of director.cpp: prices a file of contracts with 
+// the Binomial Method on all cores and writes prices and per-contract
+// timings to a CSV file. Intended for overnight jobs and profiling.
+//
+//	batchdirector input.csv output.csv [threads] [none|bbs|richardson|bbsr]
+//
+// 2026-10-19 First code 
+//
+
+#include "BatchPricer.hpp"
+
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+using namespace std;
+
+int main(int argc, char* argv[])
+{
+	if (argc < 3)
+	{
+		cout << "Usage: " << argv[0] << " input.csv output.csv [threads] [none|bbs|richardson|bbsr]\n";
+		return 1;
+	}
+
+	unsigned nThreads = 0;	// All cores
+	if (argc > 3)
+		nThreads = unsigned(atoi(argv[3]));
+
+	BinomialAcceleration acc = NoAcceleration;
+	if (argc > 4)
+	{
+		string mode = argv[4];
+		if (mode == "bbs")
+			acc = BBSSmoothing;
+		else if (mode == "richardson")
+			acc = Richardson;
+		else if (mode == "bbsr")
+			acc = BBSRichardson;
+		else if (mode != "none")
+		{
+			cout << "Unknown acceleration " << mode << endl;
+			return 1;
+		}
+	}
+
+	try
+	{
+		vector<OptionSpec> specs = readOptionSpecs(argv[1]);
+
+		chrono::steady_clock::time_point start = chrono::steady_clock::now();
+		vector<BatchResult> results = priceBatch(specs, nThreads, acc);
+		chrono::duration<double> elapsed = chrono::steady_clock::now() - start;
+
+		writeResultsCSV(argv[2], specs, results);
+
+		cout << "Priced " << specs.size() << " contracts in " << elapsed.count() << " s\n";
+	}
+	catch (DatasimException& e)
+	{
+		e.print();
+		return 1;
+	}
+
+	return 0;
+}
@@ -5,6 +5,8 @@
 // as it were.
 //
 // 2005-1-31 DD First official code 
+// 2026-10-19 getStrategy() asks again on invalid input; see batchdirector.cpp
+//			for the non-interactive version
 //
 // The mediator class in the Binomial method
 // 
@@ -30,31 +32,19 @@ EuropeanOptionFactory* getFactory()
 BinomialLatticeStrategy* getStrategy(double sig, double r, double k, 
 										double S, double K, int N)
 {
-	cout << "\n1. CRR, 2. JR, 3. TRG, 4. EQP, 5. Modified CRR:\n6. Cayley JR Transform: 7 Cayley CRR: ";
-	int choice;
-	cin >> choice;
+	BinomialLatticeStrategy* str = 0;
 
-	if (choice == 1)
-		return new CRRStrategy(sig,r,k);
-
-	if (choice == 2)
-		return new JRStrategy(sig,r,k);
-
-	if (choice == 3)
-		return new TRGStrategy(sig,r,k);
-
-	if (choice == 4)
-		return new EQPStrategy(sig,r,k);
-
-	if (choice == 5)
-		return new ModCRRStrategy(sig,r,k, S, K, N);
-
-	if (choice == 6)
-		return new PadeJRStrategy(sig,r,k);
+	while (str == 0)
+	{
+		cout << "\n1. CRR, 2. JR, 3. TRG, 4. EQP, 5. Modified CRR:\n6. Cayley JR Transform: 7 Cayley CRR: ";
+		int choice = 0;
+		if (!(cin >> choice))
+			return 0;	// End of input
 
-	if (choice == 7)
-		return new PadeCRRStrategy(sig,r,k);
+		str = createStrategy(choice, sig, r, k, S, K, N);
+	}
 
+	return str;
 }
 
 
@@ -64,7 +54,7 @@ Vector<double, int> calcPayoffVector(Vector<double, int> xarr, const Option& opt
 	// We need the form of the lattice at the 'base' of the pyramid. This
 	// will be needed when we use backward induction 
 	
-	Vector<double, int> result (xarr);
+	Vector<double, int> result (std::move(xarr));
 
 	// Now use functionMechanisms 
 	/* Vector<double, int> 
@@ -103,6 +93,12 @@ int main()
 
 	// Phase II: Create the binomial metjod
 	BinomialLatticeStrategy* lf = getStrategy(opt->sig, opt->r, k, S, opt->K, N);
+	if (lf == 0)
+	{
+		delete opt;
+		return 1;
+	}
+
 	BinomialMethod bn(discounting, *lf, N);
 
 	// Phase III: Forward Induction
@@ -123,11 +119,9 @@ int main()
 
 	Vector<double, int> Pay = calcPayoffVector(RHS, *opt);
 
-	double pr = bn.getPrice(Pay);
+	double pr = bn.getPrice(std::move(Pay));
 	cout << "PriceN: " << pr << endl;
 
-	fac = getFactory();
-
 	delete lf; delete opt;
 
 	return 0;
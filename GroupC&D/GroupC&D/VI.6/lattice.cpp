@@ -14,6 +14,7 @@
 //  methods into 1 class
 //	2005-1-4 DD improved, optimised code
 //	2005-11-2 DD testing etc.
+//	2026-10-19 move constructor and assignment; rows built in place
 //
 // (C) Datasim Component Technology 2001-2006
 
@@ -48,7 +49,7 @@ template <class V, class I, int NumberNodes> Lattice< V, I, NumberNodes>::Lattic
 
 	I currentBranch = 1;	// There is always one single root
 
-	// Initialise tree vectors (give sizes of vectors)
+	// Initialise tree vectors (give sizes of vectors); each row is moved into place
 	for(int n = tree.MinIndex(); n <= tree.MaxIndex(); n++)
 	{
 		tree[n] = 	Vector<V, I>(currentBranch,1);	
@@ -92,6 +93,11 @@ template <class V, class I, int NumberNodes> Lattice<V, I, NumberNodes>::Lattice
 	nrows = source.nrows;
 }
 
+template <class V, class I, int NumberNodes> Lattice<V, I, NumberNodes>::Lattice(Lattice<V, I, NumberNodes>&& source) noexcept
+	: tree(std::move(source.tree)), nrows(source.nrows), typ(source.typ)
+{ // Move constructor
+}
+
 template <class V, class I, int NumberNodes> Lattice<V, I, NumberNodes>::~Lattice()
 { // Destructor
 
@@ -112,6 +118,19 @@ template <class V, class I, int NumberNodes> Lattice<V, I, NumberNodes>& Lattice
 	return *this;
 }
 
+template <class V, class I, int NumberNodes> Lattice<V, I, NumberNodes>& Lattice< V, I, NumberNodes>::operator = (Lattice<V, I, NumberNodes>&& source) noexcept
+{ // Move assignment
+
+	if (this == &source)
+		return *this;
+
+	tree = std::move(source.tree);
+	typ = source.typ;
+	nrows = source.nrows;
+
+	return *this;
+}
+
 
 // Iterating in a Lattice; we need forward and backward versions
 template <class V, class I, int NumberNodes> I Lattice< V, I, NumberNodes>::MinIndex() const
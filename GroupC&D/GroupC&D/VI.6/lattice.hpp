@@ -44,6 +44,7 @@ public:
 	Lattice(const I& Nrows); 	// Number of rows and branch factor
 	Lattice(const I& Nrows, const V& val); // + value at nodes
 	Lattice(const Lattice<V, I, NumberNodes>& source);		// Copy constructor
+	Lattice(Lattice<V, I, NumberNodes>&& source) noexcept;	// Move constructor
 	virtual ~Lattice();							// Destructor
 
 	// Iterating in a Lattice; we need forward and backward versions
@@ -54,6 +55,7 @@ public:
 
 	// Operators
 	Lattice<V, I, NumberNodes>& operator = (const Lattice<V, I, NumberNodes>& source);
+	Lattice<V, I, NumberNodes>& operator = (Lattice<V, I, NumberNodes>&& source) noexcept;	// Move assignment
 	Vector<V, I>& operator [] (const I& nLevel );				// Subscripting operator
 	const Vector<V, I>& operator [] (const I& nLevel ) const;				// Subscripting operator
 